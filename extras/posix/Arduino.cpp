@@ -0,0 +1,106 @@
+/**
+ * The minimal Arduino core API for the POSIX host build e.g. Linux gateway.
+ *
+ * Created October 19, 2026
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#include "Arduino.h"
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+
+static const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+unsigned long millis(void)
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count();
+}
+
+unsigned long micros(void)
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
+}
+
+void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// The time slice is given to the other threads as in the cooperative cores.
+void yield(void)
+{
+    std::this_thread::yield();
+}
+
+long random(long max)
+{
+    return max > 0 ? ::random() % max : 0;
+}
+
+long random(long min, long max)
+{
+    return min < max ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed)
+{
+    if (seed != 0)
+        srandom(seed);
+}
+
+static char *toBase(unsigned long value, char *str, int base, bool negative)
+{
+    char tmp[sizeof(unsigned long) * 8 + 1];
+    int i = 0;
+    if (base < 2 || base > 36)
+        base = 10;
+    do
+    {
+        int d = value % base;
+        tmp[i++] = d < 10 ? '0' + d : 'a' + d - 10;
+        value /= base;
+    } while (value);
+    char *p = str;
+    if (negative)
+        *p++ = '-';
+    while (i)
+        *p++ = tmp[--i];
+    *p = 0;
+    return str;
+}
+
+char *itoa(int value, char *str, int base)
+{
+    return ltoa(value, str, base);
+}
+
+char *ltoa(long value, char *str, int base)
+{
+    bool negative = value < 0 && base == 10;
+    return toBase(negative ? 0UL - (unsigned long)value : (unsigned long)value, str, base, negative);
+}
+
+char *utoa(unsigned int value, char *str, int base)
+{
+    return toBase(value, str, base, false);
+}
+
+char *ultoa(unsigned long value, char *str, int base)
+{
+    return toBase(value, str, base, false);
+}
+
+char *dtostrf(double number, signed char width, unsigned char prec, char *s)
+{
+    sprintf(s, "%*.*f", width, prec, number);
+    return s;
+}
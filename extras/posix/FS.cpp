@@ -0,0 +1,294 @@
+/**
+ * The Arduino FS API for the POSIX host build.
+ *
+ * Created October 19, 2026
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#include "FS.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+fs::FS PosixFS;
+
+namespace fs
+{
+    class FileImpl
+    {
+    public:
+        ~FileImpl() { close(); }
+
+        // Map the whole file for reading.
+        bool openRead(const char *path)
+        {
+            int fd = ::open(path, O_RDONLY);
+            if (fd < 0)
+                return false;
+
+            struct stat st;
+            if (fstat(fd, &st) != 0)
+            {
+                ::close(fd);
+                return false;
+            }
+
+            if (S_ISDIR(st.st_mode))
+                dir = true;
+            else if (st.st_size > 0)
+            {
+                void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p == MAP_FAILED)
+                {
+                    ::close(fd);
+                    return false;
+                }
+                map = (const uint8_t *)p;
+                map_len = st.st_size;
+            }
+
+            // the mapping remains valid after the descriptor was closed
+            ::close(fd);
+            file_path = path;
+            opened = true;
+            return true;
+        }
+
+        bool openStdio(const char *path, const char *mode)
+        {
+            fp = fopen(path, mode);
+            if (!fp)
+                return false;
+            file_path = path;
+            opened = true;
+            return true;
+        }
+
+        size_t write(const uint8_t *buf, size_t size) { return fp ? fwrite(buf, 1, size, fp) : 0; }
+
+        size_t read(uint8_t *buf, size_t size)
+        {
+            if (fp)
+                return fread(buf, 1, size, fp);
+
+            size_t n = map_len - pos < size ? map_len - pos : size;
+            if (n)
+                memcpy(buf, map + pos, n);
+            pos += n;
+            return n;
+        }
+
+        int peek()
+        {
+            if (fp)
+            {
+                int c = fgetc(fp);
+                if (c != EOF)
+                    ungetc(c, fp);
+                return c == EOF ? -1 : c;
+            }
+            return pos < map_len ? map[pos] : -1;
+        }
+
+        bool seek(uint32_t offset, SeekMode mode)
+        {
+            if (fp)
+                return fseek(fp, offset, mode == SeekSet ? SEEK_SET : (mode == SeekCur ? SEEK_CUR : SEEK_END)) == 0;
+
+            size_t p = mode == SeekSet ? offset : (mode == SeekCur ? pos + offset : map_len + offset);
+            if (p > map_len)
+                return false;
+            pos = p;
+            return true;
+        }
+
+        size_t position() const
+        {
+            if (fp)
+            {
+                long p = ftell(fp);
+                return p < 0 ? 0 : p;
+            }
+            return pos;
+        }
+
+        size_t size() const
+        {
+            if (fp)
+            {
+                fflush(fp);
+                struct stat st;
+                return fstat(fileno(fp), &st) == 0 ? st.st_size : 0;
+            }
+            return map_len;
+        }
+
+        void flush()
+        {
+            if (fp)
+                fflush(fp);
+        }
+
+        void close()
+        {
+            if (fp)
+                fclose(fp);
+            fp = nullptr;
+            if (map)
+                munmap((void *)map, map_len);
+            map = nullptr;
+            map_len = 0;
+            pos = 0;
+            opened = false;
+        }
+
+        bool opened = false;
+        bool dir = false;
+        String file_path;
+
+    private:
+        FILE *fp = nullptr;
+        const uint8_t *map = nullptr;
+        size_t map_len = 0;
+        size_t pos = 0;
+    };
+
+    size_t File::write(uint8_t c) { return write(&c, 1); }
+
+    size_t File::write(const uint8_t *buf, size_t size) { return _p ? _p->write(buf, size) : 0; }
+
+    int File::available()
+    {
+        if (!_p)
+            return 0;
+        size_t sz = _p->size(), pos = _p->position();
+        return sz > pos ? sz - pos : 0;
+    }
+
+    int File::read()
+    {
+        uint8_t c;
+        return read(&c, 1) == 1 ? c : -1;
+    }
+
+    int File::peek() { return _p ? _p->peek() : -1; }
+
+    void File::flush()
+    {
+        if (_p)
+            _p->flush();
+    }
+
+    size_t File::read(uint8_t *buf, size_t size) { return _p ? _p->read(buf, size) : 0; }
+
+    bool File::seek(uint32_t pos, SeekMode mode) { return _p ? _p->seek(pos, mode) : false; }
+
+    size_t File::position() const { return _p ? _p->position() : 0; }
+
+    size_t File::size() const { return _p ? _p->size() : 0; }
+
+    void File::close()
+    {
+        if (_p)
+            _p->close();
+        _p = nullptr;
+    }
+
+    File::operator bool() const { return _p && _p->opened; }
+
+    const char *File::path() const { return _p ? _p->file_path.c_str() : nullptr; }
+
+    const char *File::name() const
+    {
+        const char *p = path();
+        const char *s = p ? strrchr(p, '/') : nullptr;
+        return s ? s + 1 : p;
+    }
+
+    bool File::isDirectory() const { return _p && _p->dir; }
+
+    static bool makeDir(const char *path)
+    {
+        return ::mkdir(path, 0755) == 0 || errno == EEXIST;
+    }
+
+    bool FS::begin(const char *root)
+    {
+        if (root)
+            _root = root;
+
+        // create the root and its parents
+        String dir = _root;
+        for (unsigned int i = 1; i < dir.length(); i++)
+        {
+            if (dir[i] == '/')
+            {
+                dir[i] = 0;
+                makeDir(dir.c_str());
+                dir[i] = '/';
+            }
+        }
+        makeDir(dir.c_str());
+
+        struct stat st;
+        return stat(_root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    }
+
+    bool FS::format()
+    {
+        DIR *d = opendir(_root.c_str());
+        if (!d)
+            return false;
+        struct dirent *e;
+        while ((e = readdir(d)) != nullptr)
+        {
+            if (strcmp(e->d_name, ".") != 0 && strcmp(e->d_name, "..") != 0)
+            {
+                String p = hostPath(e->d_name);
+                if (::unlink(p.c_str()) != 0)
+                    ::rmdir(p.c_str());
+            }
+        }
+        closedir(d);
+        return true;
+    }
+
+    String FS::hostPath(const char *path) const
+    {
+        String p = _root;
+        if (!path)
+            return p;
+        if (path[0] != '/')
+            p += '/';
+        p += path;
+        return p;
+    }
+
+    File FS::open(const char *path, const char *mode)
+    {
+        FileImplPtr p = std::make_shared<FileImpl>();
+        String hp = hostPath(path);
+        bool ret = mode && strcmp(mode, "r") == 0 ? p->openRead(hp.c_str()) : p->openStdio(hp.c_str(), mode ? mode : "r");
+        return ret ? File(p) : File();
+    }
+
+    bool FS::exists(const char *path)
+    {
+        struct stat st;
+        return stat(hostPath(path).c_str(), &st) == 0;
+    }
+
+    bool FS::remove(const char *path) { return ::unlink(hostPath(path).c_str()) == 0; }
+
+    bool FS::rename(const char *pathFrom, const char *pathTo) { return ::rename(hostPath(pathFrom).c_str(), hostPath(pathTo).c_str()) == 0; }
+
+    bool FS::mkdir(const char *path) { return makeDir(hostPath(path).c_str()); }
+
+    bool FS::rmdir(const char *path) { return ::rmdir(hostPath(path).c_str()) == 0; }
+
+} // namespace fs
@@ -0,0 +1,107 @@
+/**
+ * The Arduino FS API for the POSIX host build.
+ *
+ * Created October 19, 2026
+ *
+ * The files are mapped to the directory (root) of the host file system.
+ * The file opened for reading is memory mapped (mmap), the file opened for writing or appending uses stdio.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#ifndef POSIX_HOST_FS_H
+#define POSIX_HOST_FS_H
+
+#include <memory>
+#include "Arduino.h"
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs
+{
+    enum SeekMode
+    {
+        SeekSet = 0,
+        SeekCur = 1,
+        SeekEnd = 2
+    };
+
+    class FileImpl;
+    typedef std::shared_ptr<FileImpl> FileImplPtr;
+
+    class File : public Stream
+    {
+    public:
+        File(FileImplPtr p = FileImplPtr()) : _p(p) {}
+
+        size_t write(uint8_t c) override;
+        size_t write(const uint8_t *buf, size_t size) override;
+        using Print::write;
+        int available() override;
+        int read() override;
+        int peek() override;
+        void flush() override;
+        size_t read(uint8_t *buf, size_t size);
+        size_t readBytes(char *buffer, size_t length) override { return read((uint8_t *)buffer, length); }
+        bool seek(uint32_t pos, SeekMode mode);
+        bool seek(uint32_t pos) { return seek(pos, SeekSet); }
+        size_t position() const;
+        size_t size() const;
+        void close();
+        operator bool() const;
+        const char *path() const;
+        const char *name() const;
+        bool isDirectory() const;
+
+    private:
+        FileImplPtr _p;
+    };
+
+    class FS
+    {
+    public:
+        // The root is the host directory that the file paths are relative to.
+        FS(const char *root = ".") : _root(root) {}
+
+        // Set the root when provided and create it if it does not exist.
+        bool begin(const char *root = nullptr);
+        void end() {}
+        bool format();
+
+        File open(const char *path, const char *mode = "r");
+        File open(const String &path, const char *mode = "r") { return open(path.c_str(), mode); }
+        bool exists(const char *path);
+        bool exists(const String &path) { return exists(path.c_str()); }
+        bool remove(const char *path);
+        bool remove(const String &path) { return remove(path.c_str()); }
+        bool rename(const char *pathFrom, const char *pathTo);
+        bool mkdir(const char *path);
+        bool mkdir(const String &path) { return mkdir(path.c_str()); }
+        bool rmdir(const char *path);
+        bool rmdir(const String &path) { return rmdir(path.c_str()); }
+
+        // The host path of the file.
+        String hostPath(const char *path) const;
+
+    private:
+        String _root;
+    };
+
+} // namespace fs
+
+#ifndef FS_NO_GLOBALS
+using fs::File;
+using fs::FS;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+using fs::SeekSet;
+#endif
+
+// The file system on the working directory by default.
+extern fs::FS PosixFS;
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * The Arduino IPAddress class for the POSIX host build.
+ *
+ * Created October 19, 2026
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#ifndef POSIX_HOST_IPADDRESS_H
+#define POSIX_HOST_IPADDRESS_H
+
+#include "WString.h"
+
+// IPv4 address, the uint32_t value is in network byte order as in the Arduino cores.
+class IPAddress
+{
+public:
+    IPAddress() {}
+    IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth)
+    {
+        bytes[0] = first;
+        bytes[1] = second;
+        bytes[2] = third;
+        bytes[3] = fourth;
+    }
+    IPAddress(uint32_t address) { memcpy(bytes, &address, 4); }
+    IPAddress(const uint8_t *address) { memcpy(bytes, address, 4); }
+
+    bool fromString(const char *address)
+    {
+        unsigned int b[4];
+        char end;
+        if (!address || sscanf(address, "%u.%u.%u.%u%c", &b[0], &b[1], &b[2], &b[3], &end) != 4)
+            return false;
+        for (int i = 0; i < 4; i++)
+        {
+            if (b[i] > 255)
+                return false;
+            bytes[i] = (uint8_t)b[i];
+        }
+        return true;
+    }
+    bool fromString(const String &address) { return fromString(address.c_str()); }
+
+    operator uint32_t() const
+    {
+        uint32_t v;
+        memcpy(&v, bytes, 4);
+        return v;
+    }
+    bool operator==(const IPAddress &addr) const { return memcmp(bytes, addr.bytes, 4) == 0; }
+    bool operator!=(const IPAddress &addr) const { return !(*this == addr); }
+    bool operator==(const uint8_t *addr) const { return memcmp(bytes, addr, 4) == 0; }
+    uint8_t operator[](int index) const { return bytes[index]; }
+    uint8_t &operator[](int index) { return bytes[index]; }
+    IPAddress &operator=(uint32_t address)
+    {
+        memcpy(bytes, &address, 4);
+        return *this;
+    }
+
+    String toString() const
+    {
+        char s[16];
+        snprintf(s, sizeof(s), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+        return String(s);
+    }
+
+private:
+    uint8_t bytes[4] = {0, 0, 0, 0};
+};
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * The Arduino Print class for the POSIX host build.
+ *
+ * Created October 19, 2026
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#ifndef POSIX_HOST_PRINT_H
+#define POSIX_HOST_PRINT_H
+
+#include <stdarg.h>
+#include "WString.h"
+
+class Print
+{
+public:
+    virtual ~Print() {}
+
+    int getWriteError() { return write_error; }
+    void clearWriteError() { setWriteError(0); }
+
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+        {
+            if (!write(*buffer++))
+                break;
+            n++;
+        }
+        return n;
+    }
+    size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+    size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t print(const __FlashStringHelper *s) { return write(reinterpret_cast<const char *>(s)); }
+    size_t print(const String &s) { return write(s.c_str(), s.length()); }
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char n, int base = DEC) { return print(String(n, base)); }
+    size_t print(int n, int base = DEC) { return print(String(n, base)); }
+    size_t print(unsigned int n, int base = DEC) { return print(String(n, base)); }
+    size_t print(long n, int base = DEC) { return print(String(n, base)); }
+    size_t print(unsigned long n, int base = DEC) { return print(String(n, base)); }
+    size_t print(long long n, int base = DEC) { return print(String(n, base)); }
+    size_t print(unsigned long long n, int base = DEC) { return print(String(n, base)); }
+    size_t print(double n, int digits = 2) { return print(String(n, digits)); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T &v)
+    {
+        size_t n = print(v);
+        return n + println();
+    }
+    template <typename T>
+    size_t println(const T &v, int base)
+    {
+        size_t n = print(v, base);
+        return n + println();
+    }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        va_list arg;
+        va_start(arg, format);
+        char *s = nullptr;
+        int len = vasprintf(&s, format, arg);
+        va_end(arg);
+        if (len < 0)
+            return 0;
+        size_t n = write(s, len);
+        free(s);
+        return n;
+    }
+
+protected:
+    void setWriteError(int err = 1) { write_error = err; }
+
+private:
+    int write_error = 0;
+};
+
+#endif
@@ -0,0 +1,15 @@
+/**
+ * The SPI header for the POSIX host build, there is no SPI bus on host.
+ *
+ * Created October 19, 2026
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#ifndef POSIX_HOST_SPI_H
+#define POSIX_HOST_SPI_H
+
+#include "Arduino.h"
+
+#endif
@@ -0,0 +1,92 @@
+/**
+ * The Arduino Stream class for the POSIX host build.
+ *
+ * Created October 19, 2026
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#ifndef POSIX_HOST_STREAM_H
+#define POSIX_HOST_STREAM_H
+
+#include "Print.h"
+
+unsigned long millis(void);
+void yield(void);
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeout) { _timeout = timeout; }
+    unsigned long getTimeout(void) const { return _timeout; }
+
+    virtual size_t readBytes(char *buffer, size_t length)
+    {
+        size_t count = 0;
+        while (count < length)
+        {
+            int c = timedRead();
+            if (c < 0)
+                break;
+            *buffer++ = (char)c;
+            count++;
+        }
+        return count;
+    }
+    size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+
+    size_t readBytesUntil(char terminator, char *buffer, size_t length)
+    {
+        size_t index = 0;
+        while (index < length)
+        {
+            int c = timedRead();
+            if (c < 0 || c == terminator)
+                break;
+            *buffer++ = (char)c;
+            index++;
+        }
+        return index;
+    }
+
+    String readString()
+    {
+        String ret;
+        int c;
+        while ((c = timedRead()) >= 0)
+            ret += (char)c;
+        return ret;
+    }
+
+    String readStringUntil(char terminator)
+    {
+        String ret;
+        int c;
+        while ((c = timedRead()) >= 0 && c != terminator)
+            ret += (char)c;
+        return ret;
+    }
+
+protected:
+    unsigned long _timeout = 1000;
+
+    int timedRead()
+    {
+        unsigned long start = millis();
+        do
+        {
+            int c = read();
+            if (c >= 0)
+                return c;
+            yield();
+        } while (millis() - start < _timeout);
+        return -1;
+    }
+};
+
+#endif
@@ -0,0 +1,307 @@
+/**
+ * The Arduino String class for the POSIX host build.
+ *
+ * Created October 19, 2026
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#ifndef POSIX_HOST_WSTRING_H
+#define POSIX_HOST_WSTRING_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+
+class __FlashStringHelper;
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class StringSumHelper;
+
+class String
+{
+public:
+    String(const char *cstr = "")
+    {
+        if (cstr)
+            buf = cstr;
+    }
+    String(const char *cstr, unsigned int length)
+    {
+        if (cstr)
+            buf.assign(cstr, length);
+    }
+    String(const __FlashStringHelper *str) : String(reinterpret_cast<const char *>(str)) {}
+    String(const std::string &str) : buf(str) {}
+    String(const String &str) = default;
+    String(String &&str) = default;
+    explicit String(char c) : buf(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10) { fromUnsigned(value, base); }
+    explicit String(int value, unsigned char base = 10) { fromSigned(value, base); }
+    explicit String(unsigned int value, unsigned char base = 10) { fromUnsigned(value, base); }
+    explicit String(long value, unsigned char base = 10) { fromSigned(value, base); }
+    explicit String(unsigned long value, unsigned char base = 10) { fromUnsigned(value, base); }
+    explicit String(long long value, unsigned char base = 10) { fromSigned(value, base); }
+    explicit String(unsigned long long value, unsigned char base = 10) { fromUnsigned(value, base); }
+    explicit String(float value, unsigned char decimalPlaces = 2) { fromDouble(value, decimalPlaces); }
+    explicit String(double value, unsigned char decimalPlaces = 2) { fromDouble(value, decimalPlaces); }
+    virtual ~String() {}
+
+    String &operator=(const String &rhs) = default;
+    String &operator=(String &&rhs) = default;
+    String &operator=(const char *cstr)
+    {
+        buf = cstr ? cstr : "";
+        return *this;
+    }
+    String &operator=(const __FlashStringHelper *str) { return *this = reinterpret_cast<const char *>(str); }
+
+    unsigned char reserve(unsigned int size)
+    {
+        buf.reserve(size);
+        return 1;
+    }
+    unsigned int length() const { return buf.length(); }
+    bool isEmpty() const { return buf.empty(); }
+    void clear() { buf.clear(); }
+    const char *c_str() const { return buf.c_str(); }
+    char *begin() { return &buf[0]; }
+    char *end() { return &buf[0] + buf.length(); }
+    const char *begin() const { return c_str(); }
+    const char *end() const { return c_str() + buf.length(); }
+
+    unsigned char concat(const String &str)
+    {
+        buf += str.buf;
+        return 1;
+    }
+    unsigned char concat(const char *cstr)
+    {
+        if (cstr)
+            buf += cstr;
+        return 1;
+    }
+    unsigned char concat(const char *cstr, unsigned int length)
+    {
+        if (cstr)
+            buf.append(cstr, length);
+        return 1;
+    }
+    unsigned char concat(const __FlashStringHelper *str) { return concat(reinterpret_cast<const char *>(str)); }
+    unsigned char concat(char c)
+    {
+        buf += c;
+        return 1;
+    }
+    unsigned char concat(unsigned char num) { return concat(String(num)); }
+    unsigned char concat(int num) { return concat(String(num)); }
+    unsigned char concat(unsigned int num) { return concat(String(num)); }
+    unsigned char concat(long num) { return concat(String(num)); }
+    unsigned char concat(unsigned long num) { return concat(String(num)); }
+    unsigned char concat(long long num) { return concat(String(num)); }
+    unsigned char concat(unsigned long long num) { return concat(String(num)); }
+    unsigned char concat(float num) { return concat(String(num)); }
+    unsigned char concat(double num) { return concat(String(num)); }
+
+    template <typename T>
+    String &operator+=(const T &rhs)
+    {
+        concat(rhs);
+        return *this;
+    }
+
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, const String &rhs);
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, const char *cstr);
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, const __FlashStringHelper *rhs);
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, char c);
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, int num);
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, unsigned int num);
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, long num);
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, unsigned long num);
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, double num);
+
+    int compareTo(const String &s) const { return buf.compare(s.buf); }
+    bool equals(const String &s) const { return buf == s.buf; }
+    bool equals(const char *cstr) const { return buf == (cstr ? cstr : ""); }
+    bool equalsIgnoreCase(const String &s) const { return strcasecmp(c_str(), s.c_str()) == 0; }
+    bool operator==(const String &rhs) const { return equals(rhs); }
+    bool operator==(const char *cstr) const { return equals(cstr); }
+    bool operator!=(const String &rhs) const { return !equals(rhs); }
+    bool operator!=(const char *cstr) const { return !equals(cstr); }
+    bool operator<(const String &rhs) const { return compareTo(rhs) < 0; }
+    bool operator>(const String &rhs) const { return compareTo(rhs) > 0; }
+    bool startsWith(const String &prefix, unsigned int offset = 0) const { return buf.compare(offset, prefix.length(), prefix.buf) == 0 && offset + prefix.length() <= length(); }
+    bool endsWith(const String &suffix) const { return length() >= suffix.length() && buf.compare(length() - suffix.length(), suffix.length(), suffix.buf) == 0; }
+
+    char charAt(unsigned int index) const { return index < length() ? buf[index] : 0; }
+    void setCharAt(unsigned int index, char c)
+    {
+        if (index < length())
+            buf[index] = c;
+    }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char &operator[](unsigned int index) { return buf[index]; }
+    void getBytes(unsigned char *out, unsigned int bufsize, unsigned int index = 0) const { toCharArray((char *)out, bufsize, index); }
+    void toCharArray(char *out, unsigned int bufsize, unsigned int index = 0) const
+    {
+        if (!bufsize || !out)
+            return;
+        size_t n = index < length() ? buf.copy(out, bufsize - 1, index) : 0;
+        out[n] = 0;
+    }
+
+    int indexOf(char ch, unsigned int fromIndex = 0) const { return find(buf.find(ch, fromIndex)); }
+    int indexOf(const String &str, unsigned int fromIndex = 0) const { return find(buf.find(str.buf, fromIndex)); }
+    int lastIndexOf(char ch) const { return find(buf.rfind(ch)); }
+    int lastIndexOf(char ch, unsigned int fromIndex) const { return find(buf.rfind(ch, fromIndex)); }
+    int lastIndexOf(const String &str) const { return find(buf.rfind(str.buf)); }
+    int lastIndexOf(const String &str, unsigned int fromIndex) const { return find(buf.rfind(str.buf, fromIndex)); }
+    String substring(unsigned int beginIndex) const { return beginIndex < length() ? String(buf.substr(beginIndex)) : String(); }
+    String substring(unsigned int beginIndex, unsigned int endIndex) const
+    {
+        if (beginIndex > endIndex)
+        {
+            unsigned int t = endIndex;
+            endIndex = beginIndex;
+            beginIndex = t;
+        }
+        return beginIndex < length() ? String(buf.substr(beginIndex, endIndex - beginIndex)) : String();
+    }
+
+    void replace(char find, char replace)
+    {
+        for (auto &c : buf)
+            if (c == find)
+                c = replace;
+    }
+    void replace(const String &find, const String &replace)
+    {
+        if (find.isEmpty())
+            return;
+        size_t pos = 0;
+        while ((pos = buf.find(find.buf, pos)) != std::string::npos)
+        {
+            buf.replace(pos, find.length(), replace.buf);
+            pos += replace.length();
+        }
+    }
+    void remove(unsigned int index)
+    {
+        if (index < length())
+            buf.erase(index);
+    }
+    void remove(unsigned int index, unsigned int count)
+    {
+        if (index < length())
+            buf.erase(index, count);
+    }
+    void toLowerCase()
+    {
+        for (auto &c : buf)
+            c = tolower((unsigned char)c);
+    }
+    void toUpperCase()
+    {
+        for (auto &c : buf)
+            c = toupper((unsigned char)c);
+    }
+    void trim()
+    {
+        size_t b = 0, e = buf.length();
+        while (b < e && isspace((unsigned char)buf[b]))
+            b++;
+        while (e > b && isspace((unsigned char)buf[e - 1]))
+            e--;
+        buf = buf.substr(b, e - b);
+    }
+
+    long toInt() const { return atol(c_str()); }
+    float toFloat() const { return (float)atof(c_str()); }
+    double toDouble() const { return atof(c_str()); }
+
+protected:
+    std::string buf;
+
+private:
+    static int find(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+
+    void fromUnsigned(unsigned long long value, unsigned char base)
+    {
+        char s[66];
+        int i = sizeof(s) - 1;
+        s[i] = 0;
+        if (base < 2)
+            base = 10;
+        do
+        {
+            int d = value % base;
+            s[--i] = d < 10 ? '0' + d : 'a' + d - 10;
+            value /= base;
+        } while (value);
+        buf = s + i;
+    }
+
+    void fromSigned(long long value, unsigned char base)
+    {
+        if (value < 0 && base == 10)
+        {
+            fromUnsigned(0ULL - (unsigned long long)value, base);
+            buf.insert(0, 1, '-');
+        }
+        else
+            fromUnsigned((unsigned long long)value, base);
+    }
+
+    void fromDouble(double value, unsigned char decimalPlaces)
+    {
+        char s[64];
+        snprintf(s, sizeof(s), "%.*f", decimalPlaces, value);
+        buf = s;
+    }
+};
+
+class StringSumHelper : public String
+{
+public:
+    StringSumHelper(const String &s) : String(s) {}
+    StringSumHelper(const char *p) : String(p) {}
+    StringSumHelper(char c) : String(c) {}
+    StringSumHelper(unsigned char num) : String(num) {}
+    StringSumHelper(int num) : String(num) {}
+    StringSumHelper(unsigned int num) : String(num) {}
+    StringSumHelper(long num) : String(num) {}
+    StringSumHelper(unsigned long num) : String(num) {}
+    StringSumHelper(double num) : String(num) {}
+};
+
+#define POSIX_HOST_STRING_SUM(type, expr)                                  \
+    inline StringSumHelper &operator+(const StringSumHelper &lhs, type rhs) \
+    {                                                                      \
+        StringSumHelper &a = const_cast<StringSumHelper &>(lhs);           \
+        a.concat(expr);                                                    \
+        return a;                                                          \
+    }
+
+POSIX_HOST_STRING_SUM(const String &, rhs)
+POSIX_HOST_STRING_SUM(const char *, rhs)
+POSIX_HOST_STRING_SUM(const __FlashStringHelper *, rhs)
+POSIX_HOST_STRING_SUM(char, rhs)
+POSIX_HOST_STRING_SUM(int, rhs)
+POSIX_HOST_STRING_SUM(unsigned int, rhs)
+POSIX_HOST_STRING_SUM(long, rhs)
+POSIX_HOST_STRING_SUM(unsigned long, rhs)
+POSIX_HOST_STRING_SUM(double, rhs)
+
+#undef POSIX_HOST_STRING_SUM
+
+inline bool operator==(const char *lhs, const String &rhs) { return rhs == lhs; }
+
+#endif
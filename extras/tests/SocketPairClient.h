@@ -0,0 +1,110 @@
+/**
+ * The buffered client on the socket pair for the host tests.
+ *
+ * Created October 19, 2026
+ *
+ * The test writes the server response to the peer socket (server()), the library reads it through
+ * the receive buffer of the client in the reads of random size up to maxRead bytes.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#ifndef SOCKET_PAIR_CLIENT_H
+#define SOCKET_PAIR_CLIENT_H
+
+#include <Arduino.h>
+#include <client/FB_Buffered_Client.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+class SocketPairClient : public Firebase_Buffered_Client
+{
+public:
+    SocketPairClient(size_t maxRead = 0) : maxRead(maxRead)
+    {
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0)
+            fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL, 0) | O_NONBLOCK);
+    }
+
+    ~SocketPairClient()
+    {
+        stop();
+        closeServer();
+    }
+
+    // The peer socket that the response is written to.
+    int server() const { return fds[1]; }
+
+    // Write all data to the peer socket, the client side is read when the socket buffer is full.
+    bool serverWrite(const void *data, size_t len)
+    {
+        const char *p = (const char *)data;
+        while (len > 0)
+        {
+            ssize_t n = ::write(fds[1], p, len);
+            if (n <= 0)
+                return false;
+            p += n;
+            len -= n;
+        }
+        return true;
+    }
+
+    void closeServer()
+    {
+        if (fds[1] >= 0)
+            ::close(fds[1]);
+        fds[1] = -1;
+    }
+
+    // The number of the underlying reads.
+    size_t reads = 0;
+
+    // The maximum size of the underlying read, the size is random from 1 when it is not zero.
+    size_t maxRead = 0;
+
+    int connect(IPAddress, uint16_t) { return 0; }
+    int connect(const char *, uint16_t) { return 0; }
+    size_t write(uint8_t) { return 0; }
+    size_t write(const uint8_t *, size_t) { return 0; }
+    int peek() { return -1; }
+    void flush() {}
+
+    void stop()
+    {
+        if (fds[0] >= 0)
+            ::close(fds[0]);
+        fds[0] = -1;
+        clearReadBuffer();
+    }
+
+    uint8_t connected() { return fds[0] >= 0; }
+    operator bool() { return connected(); }
+
+protected:
+    int rawAvailable()
+    {
+        int n = 0;
+        if (fds[0] < 0 || ioctl(fds[0], FIONREAD, &n) != 0)
+            return -1;
+        return n;
+    }
+
+    int rawRead(uint8_t *buf, size_t size)
+    {
+        if (maxRead > 0 && size > maxRead)
+            size = 1 + random(maxRead);
+        ssize_t n = ::read(fds[0], buf, size);
+        reads++;
+        return n < 0 ? (errno == EAGAIN ? 0 : -1) : (int)n;
+    }
+
+private:
+    int fds[2] = {-1, -1};
+};
+
+#endif
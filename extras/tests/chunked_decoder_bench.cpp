@@ -0,0 +1,96 @@
+/**
+ * The throughput benchmark of the chunked response body read through the pipeline.
+ *
+ * Created October 19, 2026
+ *
+ * Usage: chunked_decoder_bench [body size] [chunk size] [iterations]
+ *
+ * The chunked response is written to the socket pair by the server thread and read through the receive buffer
+ * of the client and the chunked decoder to the string sink, as FirebaseData::readPayload does.
+ * The result is the body throughput and the number of the underlying socket reads per response.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#include <Firebase_ESP_Client.h>
+#include <session/FB_Response_Pipeline.h>
+#include "SocketPairClient.h"
+#include <thread>
+
+int main(int argc, char *argv[])
+{
+    size_t bodySize = argc > 1 ? strtoul(argv[1], NULL, 10) : 8704;
+    size_t chunkSize = argc > 2 ? strtoul(argv[2], NULL, 10) : 1024;
+    int iterations = argc > 3 ? atoi(argv[3]) : 20000;
+
+    if (bodySize == 0 || chunkSize == 0 || iterations <= 0)
+    {
+        printf("Usage: chunked_decoder_bench [body size] [chunk size] [iterations]\n");
+        return 1;
+    }
+
+    // the JSON like body in chunks of the fixed size
+    MB_String body, response;
+    while (body.length() < bodySize)
+        body += "{\"temperature\":25.5,\"humidity\":60,\"ts\":1697702400},";
+    body.erase(bodySize);
+
+    char hex[24];
+    for (size_t pos = 0; pos < body.length(); pos += chunkSize)
+    {
+        size_t n = body.length() - pos < chunkSize ? body.length() - pos : chunkSize;
+        snprintf(hex, sizeof(hex), "%zx\r\n", n);
+        response += hex;
+        response += MB_StringView(body.c_str() + pos, n);
+        response += "\r\n";
+    }
+    response += "0\r\n\r\n";
+
+    SocketPairClient client;
+    std::thread server([&]()
+                       {
+                           for (int i = 0; i < iterations; i++)
+                               client.serverWrite(response.c_str(), response.length()); });
+
+    MB_String out;
+    out.reserve(bodySize);
+    Firebase_String_Sink sink(out);
+    Firebase_Response_Pipeline pipeline(&sink);
+    firebase_tcp_response_handler_t handler;
+    handler.chunkBufSize = 2048;
+
+    bool ok = true;
+    unsigned long start = micros();
+
+    for (int i = 0; i < iterations && ok; i++)
+    {
+        out.clear();
+        handler.chunkState.reset();
+
+        int r = 0;
+        while ((r = pipeline.read(&client, handler, true, handler.chunkBufSize)) >= 0)
+        {
+            // wait for the server
+            if (r == 0 && client.available() <= 0)
+                std::this_thread::yield();
+        }
+
+        ok = r == FIREBASE_RESPONSE_BODY_END && out.length() == body.length();
+    }
+
+    unsigned long elapsed = micros() - start;
+    server.join();
+
+    if (!ok)
+    {
+        printf("chunked_decoder_bench: the body was not read correctly\n");
+        return 1;
+    }
+
+    double mb = (double)body.length() * iterations / (1024.0 * 1024.0);
+    printf("body %zu bytes, chunk %zu bytes, %d responses\n", bodySize, chunkSize, iterations);
+    printf("%.1f MB/s, %.1f us per response, %.1f socket reads per response\n",
+           mb / (elapsed / 1e6), (double)elapsed / iterations, (double)client.reads / iterations);
+    return 0;
+}
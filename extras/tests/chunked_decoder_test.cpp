@@ -0,0 +1,225 @@
+/**
+ * The host test of the chunked transfer encoding decoder (Firebase_Chunked_Decoder) and the response
+ * body pipeline (Firebase_Response_Pipeline).
+ *
+ * Created October 19, 2026
+ *
+ * Usage: chunked_decoder_test [cases] [seed]
+ *
+ * - The random body is encoded with the random chunk sizes, extensions and trailers, the encoded data
+ *   is decoded with the random input splits and output limits and compared with the body.
+ * - The invalid framing is reported as error and never as the end of the body.
+ * - The random mutation of the encoded data does not crash the decoder (use with -fsanitize=address).
+ * - The pipeline reads the response from the socket pair in the random size reads.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#include <Firebase_ESP_Client.h>
+#include <session/FB_Response_Pipeline.h>
+#include "SocketPairClient.h"
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                                   \
+    do                                                     \
+    {                                                      \
+        if (!(cond))                                       \
+        {                                                  \
+            failures++;                                    \
+            printf("%s:%d: %s ", __FILE__, __LINE__, #cond); \
+            printf(__VA_ARGS__);                           \
+            printf("\n");                                  \
+        }                                                  \
+    } while (0)
+
+static MB_String randomBody(size_t len)
+{
+    MB_String s;
+    for (size_t i = 0; i < len; i++)
+        s += (char)(random(4) == 0 ? random(256) : ' ' + random(95));
+    return s;
+}
+
+// Encode the body with the random framing, the bytes after the last chunk are not part of the response.
+static MB_String encode(const MB_String &body)
+{
+    MB_String out;
+    size_t pos = 0;
+    char hex[32];
+
+    while (pos < body.length())
+    {
+        size_t n = 1 + random(600);
+        if (n > body.length() - pos)
+            n = body.length() - pos;
+
+        snprintf(hex, sizeof(hex), random(2) ? "%0*zx" : "%0*zX", (int)random(4), n);
+        out += hex;
+        if (random(4) == 0)
+            out += random(2) ? ";name=value" : " ;ext";
+        out += "\r\n";
+        out += MB_StringView(body.c_str() + pos, n);
+        out += "\r\n";
+        pos += n;
+    }
+
+    out += "0\r\n";
+    if (random(3) == 0)
+        out += "X-Trailer: value\r\n";
+    out += "\r\n";
+    return out;
+}
+
+// Decode the input in the random splits and output limits, returns the input bytes consumed.
+static size_t decodeSplit(Firebase_Chunked_Decoder &dec, const MB_String &in, MB_String &out)
+{
+    size_t pos = 0;
+    while (pos < in.length() && !dec.done() && !dec.error())
+    {
+        size_t split = 1 + random(in.length() - pos);
+        MB_StringView piece(in.c_str() + pos, split);
+        size_t used = 0;
+
+        while (used < piece.length() && !dec.done() && !dec.error())
+        {
+            MB_StringView data;
+            size_t n = dec.decode(piece.substr(used), data, 1 + random(800));
+            out += data;
+            used += n;
+            if (n == 0 && data.empty())
+                break;
+        }
+        pos += used;
+        if (used < piece.length() && !dec.done() && !dec.error())
+            break;
+    }
+    return pos;
+}
+
+static void testRoundTrip(int cases)
+{
+    for (int i = 0; i < cases; i++)
+    {
+        MB_String body = randomBody(random(4) == 0 ? random(16) : random(4096));
+        MB_String enc = encode(body);
+        size_t encLen = enc.length();
+        enc += "HTTP/1.1 200 OK\r\n"; // the next response on the connection
+
+        Firebase_Chunked_Decoder dec;
+        MB_String out;
+        size_t used = decodeSplit(dec, enc, out);
+
+        CHECK(dec.done(), "case %d: not done", i);
+        CHECK(out == body, "case %d: body mismatch %d/%d", i, (int)out.length(), (int)body.length());
+        CHECK(used == encLen, "case %d: consumed %d of %d", i, (int)used, (int)encLen);
+    }
+}
+
+static void testInvalid()
+{
+    static const char *bad[] = {
+        "zz\r\nabc",                 // not a hex digit
+        "\r\nabc",                   // no size
+        ";ext\r\nabc",               // extension without size
+        "5\r\nabcdeXX\r\n",          // no CRLF after the data
+        "3\r\nabc\r\n-1\r\n",        // negative size
+        "fffffffffffffffffff\r\n"    // size overflow
+    };
+
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        Firebase_Chunked_Decoder dec;
+        MB_String in = bad[i], out;
+        decodeSplit(dec, in, out);
+        CHECK(dec.error(), "invalid case %d was not an error", (int)i);
+        CHECK(!dec.done(), "invalid case %d was done", (int)i);
+    }
+
+    // the mutated framing must not crash, it ends as done, error or more input needed
+    for (int i = 0; i < 5000; i++)
+    {
+        MB_String enc = encode(randomBody(random(512)));
+        int flips = 1 + random(3);
+        for (int f = 0; f < flips; f++)
+            enc[random(enc.length())] = (char)random(256);
+
+        Firebase_Chunked_Decoder dec;
+        MB_String out;
+        decodeSplit(dec, enc, out);
+        CHECK(out.length() <= enc.length(), "mutation %d: output is larger than input", i);
+    }
+}
+
+// Read the response body from the socket through the pipeline, returns the last read result.
+static int pipelineRead(SocketPairClient &client, firebase_tcp_response_handler_t &handler, MB_String &out)
+{
+    Firebase_String_Sink sink(out);
+    Firebase_Response_Pipeline pipeline(&sink);
+    int r = 0;
+    for (int loops = 0; loops < 100000; loops++)
+    {
+        r = pipeline.read(&client, handler, true, 1 + random(1024));
+        if (r < 0)
+            break;
+    }
+    return r;
+}
+
+static void testPipeline(int cases)
+{
+    for (int i = 0; i < cases; i++)
+    {
+        SocketPairClient client(1 + random(64));
+        firebase_tcp_response_handler_t handler;
+
+        MB_String body = randomBody(random(8192));
+        MB_String enc = encode(body);
+        bool corrupt = random(4) == 0;
+        size_t at = 0;
+        if (corrupt)
+        {
+            // replace the CRLF after the data of the first chunk
+            at = enc.find("\r\n");
+            at = enc.find("\r\n", at + 2);
+            if (at != MB_String::npos && body.length() > 0)
+                enc[at] = 'X';
+            else
+                corrupt = false;
+        }
+
+        CHECK(client.serverWrite(enc.c_str(), enc.length()), "case %d: write failed", i);
+        client.closeServer();
+
+        MB_String out;
+        int r = pipelineRead(client, handler, out);
+
+        if (corrupt)
+        {
+            CHECK(r == FIREBASE_RESPONSE_BODY_ERROR, "case %d: corrupted framing result %d", i, r);
+            CHECK(handler.error.code == FIREBASE_ERROR_TCP_RESPONSE_CHUNKED_DATA_INVALID, "case %d: error code %d", i,
+                  handler.error.code);
+        }
+        else
+        {
+            CHECK(r == FIREBASE_RESPONSE_BODY_END, "case %d: result %d", i, r);
+            CHECK(out == body, "case %d: body mismatch %d/%d", i, (int)out.length(), (int)body.length());
+            CHECK(handler.error.code == 0, "case %d: error code %d", i, handler.error.code);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int cases = argc > 1 ? atoi(argv[1]) : 20000;
+    unsigned long seed = argc > 2 ? strtoul(argv[2], NULL, 10) : 1;
+    randomSeed(seed);
+
+    testRoundTrip(cases);
+    testInvalid();
+    testPipeline(cases / 10);
+
+    printf("chunked_decoder_test: %d cases, seed %lu, %s\n", cases, seed, failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,277 @@
+/**
+ * The host test of the DNS cache (Firebase_DNS_Cache) with the stub resolver and the test clock.
+ *
+ * Created October 19, 2026
+ *
+ * Usage: dns_cache_test [threads] [seconds]
+ *
+ * - The cached address, the expiry, the failed lookup, the expired address fallback, the invalidation,
+ *   the least recently used replacement and the refresh ahead of expiry are checked against the resolver calls.
+ * - The threads resolve, invalidate and refresh the hosts at the same time while the clock runs
+ *   (use with -fsanitize=thread), the lookups are made one at a time.
+ *
+ * The test provides millis() as the test clock instead of extras/posix/Arduino.cpp.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#include <Arduino.h>
+#include <client/FB_DNS_Cache.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                                   \
+    do                                                     \
+    {                                                      \
+        if (!(cond))                                       \
+        {                                                  \
+            failures++;                                    \
+            printf("%s:%d: %s ", __FILE__, __LINE__, #cond); \
+            printf(__VA_ARGS__);                           \
+            printf("\n");                                  \
+        }                                                  \
+    } while (0)
+
+// The test clock in milliseconds.
+static std::atomic<unsigned long> clockMs(0);
+
+unsigned long millis(void) { return clockMs; }
+
+static void advance(uint32_t seconds) { clockMs += seconds * 1000UL; }
+
+// The stub resolver, the address is the generation and the first character of host.
+static std::atomic<int> lookups(0);
+static std::atomic<int> inFlight(0);
+static std::atomic<int> maxInFlight(0);
+static std::atomic<bool> failLookup(false);
+static std::atomic<uint8_t> generation(1);
+static std::atomic<bool> slowLookup(false);
+
+static int stubResolver(const char *name, IPAddress &ip)
+{
+    int n = ++inFlight;
+    if (n > maxInFlight)
+        maxInFlight = n;
+
+    lookups++;
+    if (slowLookup)
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+    bool ok = !failLookup;
+    if (ok)
+        ip = IPAddress(10, generation, (uint8_t)name[0], 1);
+
+    inFlight--;
+    return ok ? 1 : 0;
+}
+
+static firebase_dns_cache_entry_t entries[FIREBASE_DNS_CACHE_SIZE];
+
+static void reset(Firebase_DNS_Cache &cache)
+{
+    cache.clear();
+    lookups = 0;
+    failLookup = false;
+    generation = 1;
+}
+
+static void testCache()
+{
+    Firebase_DNS_Cache cache(entries);
+    IPAddress ip;
+
+    // no resolver
+    cache.clear();
+    CHECK(!cache.resolve("a.example.com", ip), "resolved without resolver");
+    cache.setResolver(stubResolver);
+
+    // the address is cached until the TTL
+    reset(cache);
+    CHECK(cache.resolve("a.example.com", ip) && ip == IPAddress(10, 1, 'a', 1), "first lookup");
+    CHECK(cache.resolve("A.EXAMPLE.COM", ip) && lookups == 1, "cached lookup %d", (int)lookups);
+    advance(FIREBASE_DNS_CACHE_TTL - 1);
+    CHECK(cache.resolve("a.example.com", ip) && lookups == 1, "lookup before TTL %d", (int)lookups);
+    advance(1);
+    generation = 2;
+    CHECK(cache.resolve("a.example.com", ip) && lookups == 2 && ip == IPAddress(10, 2, 'a', 1), "lookup after TTL");
+
+    // the failed lookup is kept for the negative TTL
+    reset(cache);
+    failLookup = true;
+    CHECK(!cache.resolve("b.example.com", ip) && lookups == 1, "failed lookup");
+    failLookup = false;
+    CHECK(!cache.resolve("b.example.com", ip) && lookups == 1, "failed lookup was not cached");
+    advance(FIREBASE_DNS_CACHE_NEGATIVE_TTL);
+    CHECK(cache.resolve("b.example.com", ip) && lookups == 2, "lookup after negative TTL");
+
+    // the expired address is used when the lookup failed, and retried after the negative TTL
+    reset(cache);
+    cache.resolve("c.example.com", ip);
+    advance(FIREBASE_DNS_CACHE_TTL);
+    failLookup = true;
+    CHECK(cache.resolve("c.example.com", ip) && ip == IPAddress(10, 1, 'c', 1) && lookups == 2, "expired address fallback");
+    CHECK(cache.resolve("c.example.com", ip) && lookups == 2, "fallback was not cached");
+    advance(FIREBASE_DNS_CACHE_NEGATIVE_TTL);
+    failLookup = false;
+    CHECK(cache.resolve("c.example.com", ip) && lookups == 3, "lookup after fallback");
+
+    // the invalidated address is looked up again, the failed lookup is kept
+    reset(cache);
+    cache.resolve("d.example.com", ip);
+    cache.invalidate("d.example.com");
+    CHECK(cache.resolve("d.example.com", ip) && lookups == 2, "lookup after invalidate");
+    failLookup = true;
+    cache.resolve("e.example.com", ip);
+    cache.invalidate("e.example.com");
+    CHECK(!cache.resolve("e.example.com", ip) && lookups == 3, "failed lookup was invalidated");
+
+    // the least recently used entry is replaced
+    reset(cache);
+    char host[32];
+    for (int i = 0; i < FIREBASE_DNS_CACHE_SIZE; i++)
+    {
+        snprintf(host, sizeof(host), "%c.example.com", 'f' + i);
+        cache.resolve(host, ip);
+        advance(1);
+    }
+    cache.resolve("f.example.com", ip); // the second host is the least recently used now
+    cache.resolve("z.example.com", ip);
+    lookups = 0;
+    cache.resolve("f.example.com", ip);
+    CHECK(lookups == 0, "recently used entry was replaced");
+    cache.resolve("g.example.com", ip);
+    CHECK(lookups == 1, "least recently used entry was kept");
+
+    // the host name that is too long is resolved but not cached
+    reset(cache);
+    std::string longHost;
+    while (longHost.length() < FIREBASE_DNS_CACHE_HOST_LENGTH)
+        longHost += "long.";
+    CHECK(cache.resolve(longHost.c_str(), ip) && cache.resolve(longHost.c_str(), ip) && lookups == 2, "long host");
+}
+
+static void testRefresh()
+{
+    Firebase_DNS_Cache cache(entries);
+    cache.setResolver(stubResolver);
+    IPAddress ip;
+
+    // nothing to renew before the refresh ahead time
+    reset(cache);
+    cache.resolve("a.example.com", ip);
+    cache.resolve("b.example.com", ip);
+    advance(FIREBASE_DNS_CACHE_TTL - FIREBASE_DNS_CACHE_REFRESH_AHEAD - 1);
+    cache.refresh();
+    CHECK(lookups == 2, "renewed before refresh ahead %d", (int)lookups);
+
+    // one address is renewed on each refresh
+    advance(1);
+    generation = 2;
+    cache.refresh();
+    CHECK(lookups == 3, "first refresh %d", (int)lookups);
+    cache.refresh();
+    CHECK(lookups == 4, "second refresh %d", (int)lookups);
+    cache.refresh();
+    CHECK(lookups == 4, "renewed twice %d", (int)lookups);
+
+    // the renewed address is used after the old one was expired
+    advance(FIREBASE_DNS_CACHE_REFRESH_AHEAD);
+    CHECK(cache.resolve("a.example.com", ip) && ip == IPAddress(10, 2, 'a', 1) && lookups == 4, "renewed address");
+
+    // the failed renewal is retried after the negative TTL, the address is kept
+    reset(cache);
+    cache.resolve("c.example.com", ip);
+    advance(FIREBASE_DNS_CACHE_TTL - FIREBASE_DNS_CACHE_REFRESH_AHEAD);
+    failLookup = true;
+    cache.refresh();
+    cache.refresh();
+    CHECK(lookups == 2, "failed renewal was not delayed %d", (int)lookups);
+    CHECK(cache.resolve("c.example.com", ip) && ip == IPAddress(10, 1, 'c', 1), "address was removed by failed renewal");
+    advance(FIREBASE_DNS_CACHE_NEGATIVE_TTL);
+    cache.refresh();
+    CHECK(lookups == 3, "failed renewal was not retried %d", (int)lookups);
+
+    // the address that was not used within the TTL is left to expire
+    reset(cache);
+    cache.resolve("d.example.com", ip);
+    advance(FIREBASE_DNS_CACHE_TTL - FIREBASE_DNS_CACHE_REFRESH_AHEAD);
+    cache.refresh();
+    CHECK(lookups == 2, "used address was not renewed %d", (int)lookups);
+    advance(FIREBASE_DNS_CACHE_TTL - FIREBASE_DNS_CACHE_REFRESH_AHEAD);
+    cache.refresh();
+    CHECK(lookups == 2, "unused address was renewed %d", (int)lookups);
+}
+
+static void testThreads(int threads, int seconds)
+{
+    Firebase_DNS_Cache cache(entries);
+    cache.setResolver(stubResolver);
+    reset(cache);
+    slowLookup = true;
+    maxInFlight = 0;
+
+    std::atomic<bool> stop(false);
+    std::atomic<int> wrong(0);
+    std::vector<std::thread> workers;
+
+    for (int i = 0; i < threads; i++)
+    {
+        workers.push_back(std::thread([&, i]()
+                                      {
+                                          unsigned int seed = i + 1;
+                                          char host[32];
+                                          while (!stop)
+                                          {
+                                              int r = rand_r(&seed);
+                                              snprintf(host, sizeof(host), "%c.example.com", 'a' + r % (FIREBASE_DNS_CACHE_SIZE + 2));
+                                              IPAddress ip;
+                                              switch (r % 8)
+                                              {
+                                              case 0:
+                                                  cache.invalidate(host);
+                                                  break;
+                                              case 1:
+                                                  cache.refresh();
+                                                  break;
+                                              default:
+                                                  // the address is always of the host
+                                                  if (cache.resolve(host, ip) && ip[2] != (uint8_t)host[0])
+                                                      wrong++;
+                                              }
+                                          } }));
+    }
+
+    // the clock runs through the expiry and the refresh of the entries
+    unsigned long end = seconds * 1000UL;
+    for (unsigned long t = 0; t < end; t += 10)
+    {
+        advance(3);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    stop = true;
+    for (size_t i = 0; i < workers.size(); i++)
+        workers[i].join();
+
+    slowLookup = false;
+    CHECK(wrong == 0, "%d addresses of the other host", (int)wrong);
+    CHECK(maxInFlight == 1, "%d lookups at the same time", (int)maxInFlight);
+}
+
+int main(int argc, char *argv[])
+{
+    int threads = argc > 1 ? atoi(argv[1]) : 4;
+    int seconds = argc > 2 ? atoi(argv[2]) : 2;
+
+    testCache();
+    testRefresh();
+    testThreads(threads, seconds);
+
+    printf("dns_cache_test: %d threads, %d seconds, %s\n", threads, seconds, failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
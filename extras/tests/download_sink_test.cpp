@@ -0,0 +1,251 @@
+/**
+ * The host test of the base64 decoder (Firebase_Base64_Decoder) and the download sinks of the response
+ * body pipeline (Firebase_Base64_Sink, Firebase_File_Sink and Firebase_Callback_Sink).
+ *
+ * Created October 19, 2026
+ *
+ * Usage: download_sink_test [cases] [seed]
+ *
+ * - The random binary data is base64 encoded with or without the pad as the RTDB file data (the JSON string),
+ *   decoded with the random input splits and output sizes and compared with the data.
+ * - The invalid encoded string is reported as error.
+ * - The file data is read from the socket pair, with the Content-Length header or chunked transfer encoding,
+ *   through the pipeline, the base64 sink and the file sink as FirebaseData::processDownload does, and the
+ *   file is compared with the data. The file that can't be written is reported as MB_FS_ERROR_FILE_IO_ERROR.
+ *
+ * The files are written to /tmp/firebase_host_tests/fs.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#include <Firebase_ESP_Client.h>
+#include <session/FB_Response_Pipeline.h>
+#include "SocketPairClient.h"
+#include <string>
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                                   \
+    do                                                     \
+    {                                                      \
+        if (!(cond))                                       \
+        {                                                  \
+            failures++;                                    \
+            printf("%s:%d: %s ", __FILE__, __LINE__, #cond); \
+            printf(__VA_ARGS__);                           \
+            printf("\n");                                  \
+        }                                                  \
+    } while (0)
+
+// The binary data is kept in std::string as MB_String is zero terminated.
+class StdString_Sink : public Firebase_Response_Sink
+{
+public:
+    StdString_Sink(std::string &out) : out(out) {}
+
+    bool write(const char *data, size_t len)
+    {
+        out.append(data, len);
+        return true;
+    }
+
+private:
+    std::string &out;
+};
+
+static std::string randomData(size_t len)
+{
+    std::string s;
+    for (size_t i = 0; i < len; i++)
+        s += (char)random(256);
+    return s;
+}
+
+static std::string encode(const std::string &data, bool pad)
+{
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    for (size_t i = 0; i < data.length(); i += 3)
+    {
+        uint32_t v = (uint8_t)data[i] << 16;
+        size_t n = data.length() - i < 3 ? data.length() - i : 3;
+        if (n > 1)
+            v |= (uint8_t)data[i + 1] << 8;
+        if (n > 2)
+            v |= (uint8_t)data[i + 2];
+
+        for (size_t k = 0; k < 4; k++)
+        {
+            if (k <= n)
+                out += table[(v >> (18 - 6 * k)) & 0x3f];
+            else if (pad)
+                out += '=';
+        }
+    }
+    return out;
+}
+
+static void testDecode(int cases)
+{
+    for (int i = 0; i < cases; i++)
+    {
+        std::string data = randomData(random(8) == 0 ? random(8) : random(4096));
+        // the JSON string ends with the double quote, the bytes after it are not decoded
+        std::string enc = encode(data, random(2)) + "\"\r\n";
+
+        Firebase_Base64_Decoder decoder;
+        std::string out;
+        StdString_Sink sink(out);
+        Firebase_Base64_Sink base64Sink(&decoder, &sink);
+
+        bool ok = true;
+        for (size_t pos = 0; pos < enc.length() && ok;)
+        {
+            size_t n = 1 + random(enc.length() - pos);
+            ok = base64Sink.write(enc.c_str() + pos, n);
+            pos += n;
+        }
+
+        CHECK(ok && !decoder.error(), "case %d: decode error", i);
+        CHECK(decoder.done(), "case %d: not done", i);
+        CHECK(out == data, "case %d: data mismatch %d/%d", i, (int)out.length(), (int)data.length());
+
+        // the small output buffer
+        decoder.reset();
+        std::string small;
+        size_t pos = 0;
+        while (pos < enc.length() && !decoder.done() && !decoder.error())
+        {
+            uint8_t buf[8];
+            size_t n = 0;
+            pos += decoder.decode(MB_StringView(enc.c_str() + pos, enc.length() - pos), buf, 3 + random(6), n);
+            small.append((const char *)buf, n);
+        }
+        CHECK(small == data, "case %d: small output mismatch %d/%d", i, (int)small.length(), (int)data.length());
+    }
+}
+
+static void testInvalid()
+{
+    static const char *bad[] = {
+        "QUJD*\"",   // not a base64 character
+        "QUI=QQ==\"", // data after the pad
+        "QUJDR\"",   // one character in the last group
+        "QQ===\""    // too many pad
+    };
+
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        Firebase_Base64_Decoder decoder;
+        std::string out;
+        StdString_Sink sink(out);
+        Firebase_Base64_Sink base64Sink(&decoder, &sink);
+        CHECK(!base64Sink.write(bad[i], strlen(bad[i])), "invalid case %d was written", (int)i);
+        CHECK(decoder.error(), "invalid case %d was not an error", (int)i);
+        CHECK(base64Sink.errorCode() == FIREBASE_ERROR_TCP_RESPONSE_PAYLOAD_DECODE_FAILED, "invalid case %d: error code %d",
+              (int)i, base64Sink.errorCode());
+    }
+}
+
+static std::string chunkedEncode(const std::string &body)
+{
+    std::string out;
+    char hex[24];
+    for (size_t pos = 0; pos < body.length();)
+    {
+        size_t n = 1 + random(1024);
+        if (n > body.length() - pos)
+            n = body.length() - pos;
+        snprintf(hex, sizeof(hex), "%zx\r\n", n);
+        out += hex;
+        out.append(body, pos, n);
+        out += "\r\n";
+        pos += n;
+    }
+    out += "0\r\n\r\n";
+    return out;
+}
+
+static void testFileSink(int cases)
+{
+    MB_FS mbfs;
+    MB_String filename = "/download.bin";
+
+    for (int i = 0; i < cases; i++)
+    {
+        bool chunked = random(2);
+        bool unopened = random(8) == 0;
+        std::string data = randomData(random(16384));
+        std::string body = encode(data, random(2)) + "\"";
+
+        SocketPairClient client(1 + random(512));
+        firebase_tcp_response_handler_t handler;
+        std::string res = chunked ? chunkedEncode(body) : body;
+        CHECK(client.serverWrite(res.c_str(), res.length()), "case %d: write failed", i);
+        client.closeServer();
+
+        CHECK(mbfs.open(filename, mbfs_flash, mb_fs_open_mode_write) >= 0, "case %d: open failed", i);
+        // the file that was closed can't be written
+        if (unopened)
+            mbfs.close(mbfs_flash);
+
+        int r = 0;
+        {
+            Firebase_File_Sink fileSink(&mbfs, filename, mbfs_flash);
+            // the callback sink without callback writes through
+            Firebase_Callback_Sink callbackSink(nullptr, &fileSink);
+            Firebase_Base64_Sink base64Sink(&handler.base64State, &callbackSink);
+            Firebase_Response_Pipeline pipeline(&base64Sink);
+
+            int read = 0;
+            for (int loops = 0; loops < 100000; loops++)
+            {
+                r = pipeline.read(&client, handler, chunked, chunked ? 1 + random(2048) : body.length() - read);
+                if (r < 0)
+                    break;
+                read += r;
+                if (!chunked && read >= (int)body.length())
+                    break;
+            }
+        }
+        mbfs.close(mbfs_flash);
+
+        if (unopened)
+        {
+            CHECK(data.empty() || r == FIREBASE_RESPONSE_BODY_ERROR, "case %d: unopened file result %d", i, r);
+            if (r == FIREBASE_RESPONSE_BODY_ERROR)
+                CHECK(handler.error.code == MB_FS_ERROR_FILE_IO_ERROR, "case %d: error code %d", i, handler.error.code);
+            continue;
+        }
+
+        CHECK(r >= 0 || r == FIREBASE_RESPONSE_BODY_END, "case %d: result %d", i, r);
+        CHECK(handler.base64State.done(), "case %d: not done", i);
+
+        std::string file;
+        CHECK(mbfs.open(filename, mbfs_flash, mb_fs_open_mode_read) >= 0, "case %d: open to read failed", i);
+        uint8_t buf[512];
+        int n = 0;
+        while ((n = mbfs.read(mbfs_flash, buf, sizeof(buf))) > 0)
+            file.append((const char *)buf, n);
+        mbfs.close(mbfs_flash);
+
+        CHECK(file == data, "case %d: file mismatch %d/%d", i, (int)file.length(), (int)data.length());
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int cases = argc > 1 ? atoi(argv[1]) : 5000;
+    unsigned long seed = argc > 2 ? strtoul(argv[2], NULL, 10) : 1;
+    randomSeed(seed);
+
+    PosixFS.begin("/tmp/firebase_host_tests/fs");
+
+    testDecode(cases);
+    testInvalid();
+    testFileSink(cases / 20);
+
+    printf("download_sink_test: %d cases, seed %lu, %s\n", cases, seed, failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,283 @@
+/**
+ * The host test of the gzip and deflate response decoder (Firebase_Inflate) with the mock server on the socket pair.
+ *
+ * Created October 19, 2026
+ *
+ * Usage: inflate_test [cases] [seed]
+ *
+ * - The random body is compressed with zlib in gzip or zlib (deflate) format with the random level, window
+ *   and memory level, and decoded with the random input splits and compared with the body.
+ * - The server thread writes the response headers and the compressed body, with the Content-Length header or
+ *   chunked transfer encoding, to the socket pair in the random size writes. The client reads the headers with
+ *   HttpHelper and the body through the pipeline and the inflate sink as FirebaseData::readPayload does.
+ * - The corrupted compressed body is reported as FIREBASE_ERROR_TCP_RESPONSE_PAYLOAD_DECODE_FAILED.
+ *
+ * Build with -DFIREBASE_ENABLE_GZIP_RESPONSE and link with -lz.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ */
+
+#include <Firebase_ESP_Client.h>
+#include <session/FB_Response_Pipeline.h>
+#include "SocketPairClient.h"
+#include <string>
+#include <thread>
+#include <vector>
+#include <zlib.h>
+
+#if !defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+#error "inflate_test requires FIREBASE_ENABLE_GZIP_RESPONSE"
+#endif
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                                   \
+    do                                                     \
+    {                                                      \
+        if (!(cond))                                       \
+        {                                                  \
+            failures++;                                    \
+            printf("%s:%d: %s ", __FILE__, __LINE__, #cond); \
+            printf(__VA_ARGS__);                           \
+            printf("\n");                                  \
+        }                                                  \
+    } while (0)
+
+// The random JSON like (compressible) or random text body, the decoded body is kept in MB_String which is zero terminated.
+static MB_String randomBody(size_t len)
+{
+    MB_String s;
+    bool binary = random(4) == 0;
+    while (s.length() < len)
+    {
+        if (binary)
+            s += (char)random(1, 256);
+        else
+        {
+            s += "{\"id\":";
+            s += MB_String((int)random(100000));
+            s += ",\"name\":\"item\",\"value\":";
+            s += MB_String((int)random(1000));
+            s += "},";
+        }
+    }
+    s.erase(len);
+    return s;
+}
+
+// Compress the body in gzip (16 + window bits) or zlib format, the compressed data is binary.
+static std::string compress(const MB_String &body, bool gzip)
+{
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    int windowBits = 9 + random(7);
+    if (deflateInit2(&zs, random(10), Z_DEFLATED, gzip ? 16 + windowBits : windowBits, 1 + random(9), Z_DEFAULT_STRATEGY) != Z_OK)
+        return std::string();
+
+    std::string out;
+    char buf[512];
+    zs.next_in = (Bytef *)body.c_str();
+    zs.avail_in = body.length();
+
+    int ret = Z_OK;
+    while (ret == Z_OK)
+    {
+        zs.next_out = (Bytef *)buf;
+        zs.avail_out = sizeof(buf);
+        ret = deflate(&zs, Z_FINISH);
+        out.append(buf, sizeof(buf) - zs.avail_out);
+    }
+
+    deflateEnd(&zs);
+    return ret == Z_STREAM_END ? out : std::string();
+}
+
+static std::string chunkedEncode(const std::string &body)
+{
+    std::string out;
+    char hex[24];
+    for (size_t pos = 0; pos < body.length();)
+    {
+        size_t n = 1 + random(1024);
+        if (n > body.length() - pos)
+            n = body.length() - pos;
+        snprintf(hex, sizeof(hex), "%zx\r\n", n);
+        out += hex;
+        out.append(body, pos, n);
+        out += "\r\n";
+        pos += n;
+    }
+    out += "0\r\n\r\n";
+    return out;
+}
+
+static void testDecode(int cases)
+{
+    for (int i = 0; i < cases; i++)
+    {
+        bool gzip = random(2);
+        MB_String body = randomBody(random(8) == 0 ? random(16) : random(16384));
+        std::string comp = compress(body, gzip);
+        CHECK(comp.length() > 0, "case %d: compress failed", i);
+
+        Firebase_Inflate inflate(gzip ? Firebase_Inflate::inflate_format_gzip : Firebase_Inflate::inflate_format_zlib);
+        MB_String out;
+        Firebase_String_Sink sink(out);
+        Firebase_Inflate_Sink inflateSink(&inflate, &sink);
+
+        bool ok = true;
+        for (size_t pos = 0; pos < comp.length() && ok;)
+        {
+            size_t n = 1 + random(comp.length() - pos);
+            ok = inflateSink.write(comp.c_str() + pos, n);
+            pos += n;
+        }
+
+        CHECK(ok && !inflate.error(), "case %d: decode error", i);
+        CHECK(inflate.done(), "case %d: not done", i);
+        CHECK(out == body, "case %d: body mismatch %d/%d", i, (int)out.length(), (int)body.length());
+    }
+}
+
+// Read the response from the mock server, returns the last body read result.
+static int readResponse(SocketPairClient &client, firebase_tcp_response_handler_t &handler,
+                        server_response_data_t &response, MB_String &out)
+{
+    StringHelper sh;
+    MB_FS mbfs;
+    HttpHelper hh;
+
+    for (int loops = 0; loops < 100000 && !handler.headerEnded; loops++)
+    {
+        if (client.available() <= 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (!handler.isHeader && handler.chunkIdx == 0)
+            hh.readStatusLine(&sh, &mbfs, &client, handler, response);
+        else
+            hh.readHeader(&sh, &mbfs, &client, handler, response);
+    }
+
+    if (!handler.headerEnded)
+        return 0;
+
+    Firebase_String_Sink sink(out);
+    Firebase_Inflate_Sink inflateSink(handler.inflate, &sink);
+    Firebase_Response_Pipeline pipeline(handler.inflate ? (Firebase_Response_Sink *)&inflateSink : &sink);
+
+    int r = 0;
+    for (int loops = 0; loops < 1000000; loops++)
+    {
+        if (client.available() <= 0 && client.connected())
+            std::this_thread::yield();
+
+        r = pipeline.read(&client, handler, response.isChunkedEnc,
+                          response.isChunkedEnc ? handler.chunkBufSize : response.contentLen - handler.payloadRead);
+        if (r < 0)
+            break;
+
+        handler.payloadRead += r;
+        if (!response.isChunkedEnc && handler.payloadRead >= response.contentLen)
+            break;
+    }
+    return r;
+}
+
+static void testMockServer(int cases)
+{
+    for (int i = 0; i < cases; i++)
+    {
+        bool gzip = random(2);
+        bool chunked = random(2);
+        bool corrupt = random(5) == 0;
+
+        MB_String body = randomBody(random(16384));
+        std::string comp = compress(body, gzip);
+
+        // flip the byte in the compressed data after the gzip header
+        if (corrupt && comp.length() > 20)
+            comp[10 + random(comp.length() - 20)] ^= (char)(1 + random(255));
+        else
+            corrupt = false;
+
+        std::string res = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n";
+        res += gzip ? "Content-Encoding: gzip\r\n" : "Content-Encoding: deflate\r\n";
+        if (chunked)
+            res += "Transfer-Encoding: chunked\r\n";
+        else
+        {
+            res += "Content-Length: ";
+            res += std::to_string(comp.length());
+            res += "\r\n";
+        }
+        res += "\r\n";
+        size_t statusLen = res.find("\r\n") + 2;
+        res += chunked ? chunkedEncode(comp) : comp;
+
+        SocketPairClient client(1 + random(256));
+        firebase_tcp_response_handler_t handler;
+        server_response_data_t response;
+        handler.chunkBufSize = 1 + random(2048);
+
+        // the status line is written at once, the rest in the random size writes, the sizes are taken before
+        // the server thread starts to keep the test repeatable with the seed
+        std::vector<size_t> writes(1, statusLen);
+        for (size_t pos = statusLen; pos < res.length(); pos += writes.back())
+        {
+            size_t n = 1 + random(700);
+            writes.push_back(n < res.length() - pos ? n : res.length() - pos);
+        }
+
+        std::thread server([&]()
+                           {
+                               size_t pos = 0;
+                               for (size_t k = 0; k < writes.size(); k++)
+                               {
+                                   client.serverWrite(res.c_str() + pos, writes[k]);
+                                   pos += writes[k];
+                                   if (k % 8 == 7)
+                                       delayMicroseconds(50);
+                               }
+                               client.closeServer(); });
+
+        MB_String out;
+        int r = readResponse(client, handler, response, out);
+        server.join();
+
+        CHECK(response.httpCode == 200, "case %d: status %d", i, response.httpCode);
+        CHECK(handler.inflate != nullptr, "case %d: no decoder for %s", i, gzip ? "gzip" : "deflate");
+
+        if (corrupt)
+        {
+            // the corrupted data may still be decoded until the stream check fails (Adler-32 or CRC-32)
+            CHECK(r == FIREBASE_RESPONSE_BODY_ERROR || out != body || (handler.inflate && handler.inflate->error()),
+                  "case %d: corrupted data was decoded", i);
+            if (r == FIREBASE_RESPONSE_BODY_ERROR)
+                CHECK(handler.error.code == FIREBASE_ERROR_TCP_RESPONSE_PAYLOAD_DECODE_FAILED, "case %d: error code %d",
+                      i, handler.error.code);
+        }
+        else
+        {
+            CHECK(r >= 0 || r == FIREBASE_RESPONSE_BODY_END, "case %d: result %d", i, r);
+            CHECK(handler.inflate && handler.inflate->done(), "case %d: not done", i);
+            CHECK(out == body, "case %d: body mismatch %d/%d", i, (int)out.length(), (int)body.length());
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int cases = argc > 1 ? atoi(argv[1]) : 2000;
+    unsigned long seed = argc > 2 ? strtoul(argv[2], NULL, 10) : 1;
+    randomSeed(seed);
+
+    testDecode(cases);
+    testMockServer(cases / 4);
+
+    printf("inflate_test: %d cases, seed %lu, %s\n", cases, seed, failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
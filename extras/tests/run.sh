@@ -0,0 +1,31 @@
+#!/bin/sh
+# Build and run the host tests with the POSIX host build (extras/posix), the tests are built with ASan or TSan.
+# Usage: extras/tests/run.sh [bench]
+set -e
+
+LIB=$(cd "$(dirname "$0")/../.." && pwd)
+OUT=${OUT:-/tmp/firebase_host_tests}
+CXX=${CXX:-g++}
+CXXFLAGS="-std=gnu++11 -g -Wall -pthread -I$LIB/extras/posix -I$LIB/src"
+
+mkdir -p "$OUT"
+
+for t in chunked_decoder_test inflate_test dns_cache_test download_sink_test; do
+  # the gzip decoder test compresses the fixtures with the host zlib,
+  # the DNS cache test has its own clock and is built with TSan for the threads
+  case $t in
+    inflate_test) EXTRA="-fsanitize=address,undefined -DFIREBASE_ENABLE_GZIP_RESPONSE $LIB/extras/posix/Arduino.cpp $LIB/extras/posix/FS.cpp -lz" ;;
+    dns_cache_test) EXTRA="-fsanitize=thread" ;;
+    download_sink_test) EXTRA="-fsanitize=address,undefined $LIB/extras/posix/Arduino.cpp $LIB/extras/posix/FS.cpp" ;;
+    *) EXTRA="-fsanitize=address,undefined $LIB/extras/posix/Arduino.cpp" ;;
+  esac
+  $CXX $CXXFLAGS -O1 "$LIB/extras/tests/$t.cpp" $EXTRA -o "$OUT/$t"
+  "$OUT/$t"
+done
+
+if [ "$1" = "bench" ]; then
+  for b in chunked_decoder_bench; do
+    $CXX $CXXFLAGS -O2 "$LIB/extras/tests/$b.cpp" "$LIB/extras/posix/Arduino.cpp" -o "$OUT/$b"
+    "$OUT/$b"
+  done
+fi
@@ -49,6 +49,11 @@
 
 // FirebaseJson was already included in MB_FS.h
 #include "./mbfs/MB_FS.h"
+#include "./client/FB_Chunked_Decoder.h"
+#include "./client/FB_Base64_Decoder.h"
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+#include "./client/FB_Inflate.h"
+#endif
 
 #if (defined(ENABLE_OTA_FIRMWARE_UPDATE) || defined(FIREBASE_ENABLE_OTA_FIRMWARE_UPDATE)) && (defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB) || (defined(ENABLE_FB_STORAGE) || defined(FIREBASE_ENABLE_FB_STORAGE)) || defined(ENABLE_GC_STORAGE))
 #if defined(ESP32)
@@ -119,6 +124,11 @@
 #define STREAM_TASK_STACK_SIZE 8192
 #define QUEUE_TASK_STACK_SIZE 8192
 #define MAX_BLOB_PAYLOAD_SIZE 1024
+
+// The request payload up to this size is appended to the request header and sent in one write
+#if !defined(FIREBASE_COALESCE_PAYLOAD_SIZE)
+#define FIREBASE_COALESCE_PAYLOAD_SIZE 1024
+#endif
 #define FIREBASE_DEFAULT_TS 1618971013
 #define FIREBASE_NON_TS -1000
 #define ESP_REPORT_PROGRESS_INTERVAL 2
@@ -752,7 +762,8 @@ struct server_response_data_t
     // the available data to read in event-stream
     // and content length specific read in http response
     int contentLen = 0;
-    int chunkRange = 0;
+    // The last byte position of the "Range: bytes=0-" header or -1 if not found
+    int chunkRange = -1;
     firebase_data_type dataType = firebase_data_type::d_any;
     int payloadOfs = 0;
     bool boolData = false;
@@ -778,13 +789,7 @@ struct server_response_data_t
     MB_String pushName;
     MB_String fbError;
     MB_String transferEnc;
-};
-
-struct firebase_chunk_state_info
-{
-    int state = 0;
-    int chunkedSize = 0;
-    int dataLen = 0;
+    MB_String contentEncoding;
 };
 
 struct firebase_tcp_response_handler_t
@@ -812,8 +817,10 @@ struct firebase_tcp_response_handler_t
     size_t defaultChunkSize = 0;
     // keep the auth token generation error
     struct firebase_auth_token_error_t error;
-    // keep the http header or the first line of stream event data
+    // keep the http status line or the first line of stream event data
     MB_String header;
+    // keep the header field line that was partially read
+    MB_String headerLine;
     // time out checking for execution
     unsigned long dataTime = 0;
     // pointer to payload
@@ -831,26 +838,47 @@ struct firebase_tcp_response_handler_t
     int base64PadLenSignature = 0;
     // the tcp client pointer
     Client *client = nullptr;
-    // the chunk state info
-    firebase_chunk_state_info chunkState;
+    // the chunked transfer encoding decoder
+    Firebase_Chunked_Decoder chunkState;
+    // the decoder of the base64 encoded file data
+    Firebase_Base64_Decoder base64State;
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+    // the decoder of the gzip or deflate content encoding, it is created when the compressed payload was found
+    Firebase_Inflate *inflate = nullptr;
+#endif
 
 public:
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+    firebase_tcp_response_handler_t() {}
+
+    ~firebase_tcp_response_handler_t()
+    {
+        delete inflate;
+    }
+#endif
+
     int available()
     {
         if (client)
             return client->available();
         return false;
     }
+
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+private:
+    firebase_tcp_response_handler_t(const firebase_tcp_response_handler_t &);
+    firebase_tcp_response_handler_t &operator=(const firebase_tcp_response_handler_t &);
+#endif
 };
 
 #if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
 
 struct firebase_rtdb_address_t
 {
-    int dout = 0;
-    int din = 0;
-    int priority = 0;
-    int query = 0;
+    uintptr_t dout = 0;
+    uintptr_t din = 0;
+    uintptr_t priority = 0;
+    uintptr_t query = 0;
 };
 
 struct firebase_rtdb_request_data_info
@@ -889,6 +917,49 @@ typedef struct firebase_rtdb_download_status_info_t
 typedef void (*RTDB_UploadProgressCallback)(RTDB_UploadStatusInfo);
 typedef void (*RTDB_DownloadProgressCallback)(RTDB_DownloadStatusInfo);
 
+typedef struct firebase_rtdb_async_result_info_t
+{
+    // the order of the asynchronous request on the connection, begins with 1
+    size_t index = 0;
+    // the http status code or the TCP error code when the response can't be read
+    int httpCode = 0;
+    // the response payload e.g. the error of the failed request, it is empty for the successful request
+    MB_String payload;
+    // the number of the asynchronous requests that are waiting for the response
+    size_t pending = 0;
+
+} RTDB_AsyncResultInfo;
+
+typedef void (*RTDB_AsyncResultCallback)(RTDB_AsyncResultInfo);
+
+enum firebase_rtdb_async_state
+{
+    firebase_rtdb_async_state_status_line,
+    firebase_rtdb_async_state_headers,
+    firebase_rtdb_async_state_payload
+};
+
+// The state of the asynchronous request response that is being read by FirebaseData::poll(),
+// the partial line or payload is kept until the next poll
+struct firebase_rtdb_async_response_t
+{
+    firebase_rtdb_async_state state = firebase_rtdb_async_state_status_line;
+    struct firebase_tcp_response_handler_t handler;
+    struct server_response_data_t response;
+    MB_String payload;
+
+    void reset()
+    {
+        state = firebase_rtdb_async_state_status_line;
+        handler.headerEnded = false;
+        handler.payloadRead = 0;
+        handler.headerLine.clear();
+        handler.chunkState.reset();
+        response = server_response_data_t();
+        payload.clear();
+    }
+};
+
 struct firebase_rtdb_request_info_t
 {
     MB_String path;
@@ -1064,7 +1135,7 @@ struct firebase_stream_info_t
 
 struct firebase_session_info
 {
-    uint32_t ptr = 0;
+    uintptr_t ptr = 0;
     bool status = false;
 };
 
@@ -1384,6 +1455,8 @@ struct firebase_rtdb_info_t
     bool async = false;
     bool new_stream = false;
     size_t async_count = 0;
+    // the number of the asynchronous request responses that were read from the connection
+    size_t async_read = 0;
 
     uint8_t connection_status = 0;
     uint32_t queue_ID = 0;
@@ -1950,22 +2023,34 @@ struct firebase_firestore_document_write_t
 
 #endif
 
+/* The request header fields which are the same for all requests to the host */
+struct firebase_request_header_template_t
+{
+    // the googleapis sub domain or the host, and the custom headers that the fields were built from
+    PGM_P sub = nullptr;
+    MB_String host;
+    MB_String customHeaders;
+    // "Host", "User-Agent" and the custom header fields
+    MB_String fields;
+};
+
 struct firebase_session_info_t
 {
     int long_running_task = 0;
     FirebaseJson *jsonPtr = nullptr;
     FirebaseJsonArray *arrPtr = nullptr;
     FirebaseJsonData *dataPtr = nullptr;
-    int jsonAddr = 0;
-    int arrAddr = 0;
+    uintptr_t jsonAddr = 0;
+    uintptr_t arrAddr = 0;
     firebase_con_mode con_mode = firebase_con_mode_undefined;
     volatile bool streaming = false;
     bool buffer_ovf = false;
     bool chunked_encoding = false;
     bool classic_request = false;
     MB_String host;
+    struct firebase_request_header_template_t header_template;
     unsigned long last_conn_ms = 0;
-    int cert_ptr = 0;
+    uintptr_t cert_ptr = 0;
     bool cert_updated = false;
     uint32_t conn_timeout = DEFAULT_TCP_CONNECTION_TIMEOUT;
 
@@ -2095,6 +2180,12 @@ static const char firebase_pgm_str_67[] PROGMEM = "data";
 static const char firebase_pgm_str_68[] PROGMEM = "update";
 static const char firebase_pgm_str_69[] PROGMEM = "delete";
 static const char firebase_pgm_str_70[] PROGMEM = "updateMask";
+static const char firebase_pgm_str_71[] PROGMEM = "Range: ";
+static const char firebase_pgm_str_72[] PROGMEM = "bytes=0-";
+static const char firebase_pgm_str_73[] PROGMEM = "Content-Encoding: ";
+static const char firebase_pgm_str_74[] PROGMEM = "gzip";
+static const char firebase_pgm_str_75[] PROGMEM = "deflate";
+static const char firebase_pgm_str_76[] PROGMEM = "Accept-Encoding: gzip, deflate\r\n";
 
 // Legacy FCM string
 #if defined(FIREBASE_ESP32_CLIENT) || defined(FIREBASE_ESP8266_CLIENT)
@@ -2416,7 +2507,6 @@ static const char firebase_gcs_pgm_str_44[] PROGMEM = "prefix=";
 static const char firebase_gcs_pgm_str_45[] PROGMEM = "startOffset=";
 static const char firebase_gcs_pgm_str_46[] PROGMEM = "versions=";
 static const char firebase_gcs_pgm_str_47[] PROGMEM = "resumableUploadTask";
-static const char firebase_gcs_pgm_str_48[] PROGMEM = "Range: bytes=0-";
 #endif
 
 // Firebase Functions class string
@@ -2570,6 +2660,8 @@ static const char firebase_client_err_pgm_str_10[] PROGMEM = "upload timed out";
 static const char firebase_client_err_pgm_str_11[] PROGMEM = "upload data sent error";
 static const char firebase_client_err_pgm_str_12[] PROGMEM = "custom Client is not yet enabled";
 static const char firebase_client_err_pgm_str_13[] PROGMEM = "Client is not yet initialized";
+static const char firebase_client_err_pgm_str_14[] PROGMEM = "invalid chunked transfer encoding of response";
+static const char firebase_client_err_pgm_str_15[] PROGMEM = "response payload decode failed";
 
 // HTTP error string
 static const char firebase_http_err_pgm_str_1[] PROGMEM = "bad request";
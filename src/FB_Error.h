@@ -29,6 +29,10 @@
 #define FIREBASE_ERROR_TCP_CLIENT_MISSING_NETWORK_CONNECTION_CB -8
 #define FIREBASE_ERROR_TCP_CLIENT_MISSING_NETWORK_STATUS_CB -9
 #define FIREBASE_ERROR_TCP_CLIENT_NOT_INITIALIZED -10
+// The chunked transfer encoding of the response payload is invalid
+#define FIREBASE_ERROR_TCP_RESPONSE_CHUNKED_DATA_INVALID (-11)
+// The response payload can't be decoded e.g. the corrupted gzip data
+#define FIREBASE_ERROR_TCP_RESPONSE_PAYLOAD_DECODE_FAILED (-12)
 
 
 /// HTTP codes see RFC7231
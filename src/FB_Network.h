@@ -210,6 +210,12 @@
 #define FIREBASE_GSM_MODEM_IS_AVAILABLE
 #endif
 
+// The native build on POSIX host e.g. Linux gateway, WiFiClientImpl uses the POSIX sockets
+// and it can be used as the external generic client.
+#if defined(MB_POSIX_HOST)
+#define FIREBASE_POSIX_SOCKET
+#endif
+
 #if defined(FIREBASE_WIFI_IS_AVAILABLE)
 #define WiFI_CONNECTED (WiFi.status() == WL_CONNECTED)
 #else
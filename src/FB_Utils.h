@@ -37,6 +37,8 @@
 
 #include <Arduino.h>
 #include "./FB_Const.h"
+#include "./client/FB_Buffered_Client.h"
+#include "./session/FB_Response_Pipeline.h"
 #if defined(ESP8266)
 #include <Schedule.h>
 #endif
@@ -102,32 +104,41 @@ public:
         return mbfs->getReservedLen(len);
     }
 
-    void pushTk(const MB_String &str, MB_VECTOR<MB_String> &tk)
+    void pushTk(MB_StringView str, MB_VECTOR<MB_String> &tk)
     {
-        MB_String s = str;
-        s.trim();
+        MB_StringView s = str.trim();
+        if (s.length() > 0)
+            tk.push_back(MB_String(s));
+    }
+
+    void pushTk(MB_StringView str, MB_VECTOR<MB_StringView> &tk)
+    {
+        MB_StringView s = str.trim();
         if (s.length() > 0)
             tk.push_back(s);
     }
 
-    void splitTk(const MB_String &str, MB_VECTOR<MB_String> &tk, const char *delim)
+    /* Split the string into the trimmed tokens, the view tokens refer to the characters of str */
+    template <typename T>
+    void splitTk(MB_StringView str, MB_VECTOR<T> &tk, const char *delim)
     {
+        MB_StringView d = delim;
         size_t current, previous = 0;
-        current = str.find(delim, previous);
-        while (current != MB_String::npos)
+        current = str.find(d, previous);
+        while (current != MB_StringView::npos)
         {
             pushTk(str.substr(previous, current - previous), tk);
-            previous = current + strlen(delim);
-            current = str.find(delim, previous);
+            previous = current + d.length();
+            current = str.find(d, previous);
         }
-        pushTk(str.substr(previous, current - previous), tk);
+        pushTk(str.substr(previous), tk);
     }
 
-    bool find(const MB_String &src, PGM_P token, bool last, size_t offset, int &pos)
+    bool find(MB_StringView src, PGM_P token, bool last, size_t offset, int &pos)
     {
-        size_t ret = last ? src.find_last_of(pgm2Str(token), offset) : src.find(pgm2Str(token), offset);
+        size_t ret = last ? src.rfindP(token, offset) : src.findP(token, offset);
 
-        if (ret != MB_String::npos)
+        if (ret != MB_StringView::npos)
         {
             pos = ret;
             return true;
@@ -136,11 +147,9 @@ public:
         return false;
     }
 
-    bool compare(const MB_String &src, int ofs, PGM_P token, bool caseInSensitive = false)
+    bool compare(MB_StringView src, int ofs, PGM_P token, bool caseInSensitive = false)
     {
-        MB_String copy;
-        src.substr(copy, ofs, strlen_P(token));
-        return caseInSensitive ? (strcasecmp(pgm2Str(token), copy.c_str()) == 0) : (strcmp(pgm2Str(token), copy.c_str()) == 0);
+        return ofs >= 0 && src.startsWithP(token, ofs, caseInSensitive);
     }
 
     /* convert string to boolean */
@@ -159,49 +168,58 @@ public:
         return MB_String(str2Bool(v.c_str()));
     }
 
-    bool tokenSubString(const MB_String &src, MB_String &out, PGM_P token1, PGM_P token2,
+    bool tokenSubString(MB_StringView src, MB_StringView &out, PGM_P token1, PGM_P token2,
                         int &ofs1, int ofs2, bool advanced)
     {
-        size_t pos1 = src.find(pgm2Str(token1), ofs1);
-        size_t pos2 = MB_String::npos;
+        size_t pos1 = ofs1 >= 0 ? src.findP(token1, ofs1) : MB_StringView::npos;
+        size_t pos2 = MB_StringView::npos;
 
         int len1 = strlen_P(token1);
         int len2 = 0;
 
-        if (pos1 != MB_String::npos)
+        if (pos1 != MB_StringView::npos)
         {
             if (ofs2 > 0)
                 pos2 = ofs2;
             else if (ofs2 == 0)
             {
                 len2 = strlen_P(token2);
-                pos2 = src.find(pgm2Str(token2), pos1 + len1 + 1);
+                pos2 = src.findP(token2, pos1 + len1 + 1);
             }
             else if (ofs2 == -1)
                 ofs1 = pos1 + len1;
 
-            if (pos2 == MB_String::npos)
+            if (pos2 == MB_StringView::npos)
                 pos2 = src.length();
 
-            if (pos2 != MB_String::npos)
-            {
-                // advanced the begin position before return
-                if (advanced)
-                    ofs1 = pos2 + len2;
-                out = src.substr(pos1 + len1, pos2 - pos1 - len1);
-                return true;
-            }
+            // advanced the begin position before return
+            if (advanced)
+                ofs1 = pos2 + len2;
+            out = src.substr(pos1 + len1, pos2 - pos1 - len1);
+            return true;
         }
 
         return false;
     }
 
-    bool tokenSubStringInt(const MB_String &buf, int &out, PGM_P token1, PGM_P token2, int &ofs1, int ofs2, bool advanced)
+    bool tokenSubString(MB_StringView src, MB_String &out, PGM_P token1, PGM_P token2,
+                        int &ofs1, int ofs2, bool advanced)
+    {
+        MB_StringView s;
+        if (tokenSubString(src, s, token1, token2, ofs1, ofs2, advanced))
+        {
+            out = s;
+            return true;
+        }
+        return false;
+    }
+
+    bool tokenSubStringInt(MB_StringView buf, int &out, PGM_P token1, PGM_P token2, int &ofs1, int ofs2, bool advanced)
     {
-        MB_String s;
+        MB_StringView s;
         if (tokenSubString(buf, s, token1, token2, ofs1, ofs2, advanced))
         {
-            out = atoi(s.c_str());
+            out = s.toInt();
             return true;
         }
         return false;
@@ -675,6 +693,14 @@ public:
                             : firebase_pgm_str_37 /* "Connection: close\r\n" */;
     }
 
+    /* Request the compressed response, the header is added only when the decoder was enabled */
+    void addAcceptEncodingHeader(MB_String &header)
+    {
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+        header += firebase_pgm_str_76; // "Accept-Encoding: gzip, deflate\r\n"
+#endif
+    }
+
     /* Append the string with first request line (HTTP method) */
     bool addRequestHeaderFirst(MB_String &header, firebase_request_method method)
     {
@@ -730,50 +756,164 @@ public:
             header += firebase_pgm_str_47; // "key="
     }
 
-    void parseRespHeader(StringHelper *sh, const MB_String &src, struct server_response_data_t &response)
+    /* Append the Authorization header with the token */
+    void addAuthHeader(MB_String &header, firebase_auth_token_type type, const char *token)
+    {
+        addAuthHeaderFirst(header, type);
+        header += token;
+        addNewLine(header);
+    }
+
+    /**
+     * Append the "Host", "User-Agent" and custom header fields of the googleapis host from the template,
+     * the fields are built again only when the host or the custom headers were changed.
+     */
+    void addGAPIsHostHeaderFields(StringHelper *sh, MB_String &header, struct firebase_request_header_template_t &tpl,
+                                  PGM_P sub, const MB_String &customHeaders)
+    {
+        if (tpl.fields.length() == 0 || tpl.sub != sub || tpl.customHeaders != customHeaders)
+        {
+            tpl.sub = sub;
+            tpl.host.clear();
+            tpl.customHeaders = customHeaders;
+            tpl.fields.clear();
+            addGAPIsHostHeader(tpl.fields, sub);
+            addUAHeader(tpl.fields);
+            getCustomHeaders(sh, tpl.fields, customHeaders);
+        }
+
+        header += tpl.fields;
+    }
+
+    /* Append the "Host", "User-Agent" and custom header fields of the host from the template */
+    void addHostHeaderFields(StringHelper *sh, MB_String &header, struct firebase_request_header_template_t &tpl,
+                             const char *host, const MB_String &customHeaders)
+    {
+        if (tpl.fields.length() == 0 || tpl.sub || tpl.host != host || tpl.customHeaders != customHeaders)
+        {
+            tpl.sub = nullptr;
+            tpl.host = host;
+            tpl.customHeaders = customHeaders;
+            tpl.fields.clear();
+            addHostHeader(tpl.fields, host);
+            addUAHeader(tpl.fields);
+            getCustomHeaders(sh, tpl.fields, customHeaders);
+        }
+
+        header += tpl.fields;
+    }
+
+    /* Parse the http headers block in one pass, line by line */
+    void parseRespHeader(StringHelper *sh, MB_StringView src, struct server_response_data_t &response)
+    {
+        size_t pos = 0;
+        while (pos < src.length())
+        {
+            size_t eol = src.find('\n', pos);
+            if (eol == MB_StringView::npos)
+                eol = src.length() - 1;
+
+            parseRespHeaderLine(sh, src.substr(pos, eol - pos + 1), response);
+            pos = eol + 1;
+        }
+
+        parseRespHeaderEnd(response);
+    }
+
+    /* Parse the http header field line, the field name is looked up by its length which is unique for each known field */
+    void parseRespHeaderLine(StringHelper *sh, MB_StringView line, struct server_response_data_t &response)
     {
-        int beginPos = 0;
+        if (response.httpCode == -1)
+            return;
 
-        MB_String out;
+        size_t p = line.find(':');
+        if (p == MB_StringView::npos)
+            return;
 
-        if (response.httpCode != -1)
+        MB_StringView name = line.substr(0, p).trim();
+        MB_StringView value = line.substr(p + 1).trim();
+
+        switch (name.length())
         {
+        case 4:
+            if (isHeaderName(name, firebase_pgm_str_49 /* "ETag: " */))
+                response.etag = value;
+            break;
+
+        case 5:
+            if (isHeaderName(name, firebase_pgm_str_71 /* "Range: " */) &&
+                value.startsWithP(firebase_pgm_str_72 /* "bytes=0-" */))
+                response.chunkRange = value.substr(strlen_P(firebase_pgm_str_72)).toInt();
+            break;
+
+        case 8:
+            if (isHeaderName(name, firebase_pgm_str_52 /* "Location: " */) &&
+                (response.httpCode == FIREBASE_ERROR_HTTP_CODE_OK ||
+                 response.httpCode == FIREBASE_ERROR_HTTP_CODE_TEMPORARY_REDIRECT ||
+                 response.httpCode == FIREBASE_ERROR_HTTP_CODE_PERMANENT_REDIRECT ||
+                 response.httpCode == FIREBASE_ERROR_HTTP_CODE_MOVED_PERMANENTLY ||
+                 response.httpCode == FIREBASE_ERROR_HTTP_CODE_FOUND))
+                response.location = value;
+            break;
 
-            sh->tokenSubString(src, response.connection,
-                               firebase_pgm_str_48 /* "Connection: " */,
-                               firebase_pgm_str_30 /* "\r\n" */, beginPos, 0, false);
-            sh->tokenSubString(src, response.contentType,
-                               firebase_pgm_str_33 /* "Content-Type: " */,
-                               firebase_pgm_str_30 /* "\r\n" */, beginPos, 0, false);
-            sh->tokenSubStringInt(src, response.contentLen,
-                                  firebase_pgm_str_34 /* "Content-Length: " */,
-                                  firebase_pgm_str_30 /* "\r\n" */, beginPos, 0, false);
-            sh->tokenSubString(src, response.etag,
-                               firebase_pgm_str_49 /* "ETag: " */,
-                               firebase_pgm_str_30 /* "\r\n" */, beginPos, 0, false);
-            response.payloadLen = response.contentLen;
-
-            if (sh->tokenSubString(src, response.transferEnc,
-                                   firebase_pgm_str_50 /* "Transfer-Encoding: " */,
-                                   firebase_pgm_str_30 /* "\r\n" */, beginPos, 0, false) &&
-                sh->compare(response.transferEnc, 0, firebase_pgm_str_51 /* "chunked" */))
-                response.isChunkedEnc = true;
-
-            if (response.httpCode == FIREBASE_ERROR_HTTP_CODE_OK ||
-                response.httpCode == FIREBASE_ERROR_HTTP_CODE_TEMPORARY_REDIRECT ||
-                response.httpCode == FIREBASE_ERROR_HTTP_CODE_PERMANENT_REDIRECT ||
-                response.httpCode == FIREBASE_ERROR_HTTP_CODE_MOVED_PERMANENTLY ||
-                response.httpCode == FIREBASE_ERROR_HTTP_CODE_FOUND)
-                sh->tokenSubString(src, response.location,
-                                   firebase_pgm_str_52 /* "Location: " */,
-                                   firebase_pgm_str_30 /* "\r\n" */, beginPos, 0, false);
-
-            if (response.httpCode == FIREBASE_ERROR_HTTP_CODE_NO_CONTENT)
-                response.noContent = true;
+        case 10:
+            if (isHeaderName(name, firebase_pgm_str_48 /* "Connection: " */))
+                response.connection = value;
+            break;
+
+        case 12:
+            if (isHeaderName(name, firebase_pgm_str_33 /* "Content-Type: " */))
+                response.contentType = value;
+            break;
+
+        case 14:
+            if (isHeaderName(name, firebase_pgm_str_34 /* "Content-Length: " */))
+                response.contentLen = value.toInt();
+            break;
+
+        case 16:
+            if (isHeaderName(name, firebase_pgm_str_73 /* "Content-Encoding: " */))
+                response.contentEncoding = value;
+            break;
+
+        case 17:
+            if (isHeaderName(name, firebase_pgm_str_50 /* "Transfer-Encoding: " */))
+            {
+                response.transferEnc = value;
+                response.isChunkedEnc = sh->compare(value, 0, firebase_pgm_str_51 /* "chunked" */);
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    /* Set the response data that depend on the complete http headers */
+    void parseRespHeaderEnd(struct server_response_data_t &response)
+    {
+        if (response.httpCode == -1)
+            return;
+
+        response.payloadLen = response.contentLen;
+
+        if (response.httpCode == FIREBASE_ERROR_HTTP_CODE_NO_CONTENT)
+            response.noContent = true;
+    }
+
+    /* Compare the header field name (case insensitive) with the field name part of the token e.g. "Connection: " */
+    bool isHeaderName(MB_StringView name, PGM_P token)
+    {
+        for (size_t i = 0; i < name.length(); i++)
+        {
+            if (tolower(name[i]) != tolower(pgm_read_byte(token + i)))
+                return false;
         }
+
+        return pgm_read_byte(token + name.length()) == ':';
     }
 
-    int getStatusCode(StringHelper *sh, const MB_String &header, int &pos)
+    int getStatusCode(StringHelper *sh, MB_StringView header, int &pos)
     {
         int code = 0;
         sh->tokenSubStringInt(header, code,
@@ -782,7 +922,7 @@ public:
         return code;
     }
 
-    void setNumDataType(const MB_String &buf, int ofs, struct server_response_data_t &response, bool dec)
+    void setNumDataType(MB_StringView buf, int ofs, struct server_response_data_t &response)
     {
         if (ofs < 0)
             return;
@@ -794,43 +934,43 @@ public:
 
         if (response.payloadLen > 0 && response.payloadLen <= len && ofs < len && ofs + response.payloadLen <= len)
         {
-            double d = atof(buf.substr(ofs, response.payloadLen).c_str());
+            MB_JSON_NumberInfo info;
+
+            if (MB_JSON_ScanNumber(buf.data() + ofs, response.payloadLen, &info) == 0)
+                return;
 
-            if (dec)
+            if (info.type == MB_JSON_NumberFloat)
             {
                 if (response.payloadLen <= 7)
                 {
-                    response.floatData = d;
+                    response.floatData = info.value;
                     response.dataType = firebase_data_type::d_float;
                 }
                 else
                 {
-                    response.doubleData = d;
+                    response.doubleData = info.value;
                     response.dataType = firebase_data_type::d_double;
                 }
             }
+            else if (info.type == MB_JSON_NumberInt)
+            {
+                response.intData = info.negative ? (int)(0 - (long long)info.integer) : (int)info.integer;
+                response.dataType = firebase_data_type::d_integer;
+            }
             else
             {
-                if (d > 0x7fffffff)
-                {
-                    response.doubleData = d;
-                    response.dataType = firebase_data_type::d_double;
-                }
-                else
-                {
-                    response.intData = (int)d;
-                    response.dataType = firebase_data_type::d_integer;
-                }
+                response.doubleData = info.value;
+                response.dataType = firebase_data_type::d_double;
             }
         }
     }
 
-    void parseRespPayload(StringHelper *sh, const MB_String &src, struct server_response_data_t &response, bool getOfs)
+    void parseRespPayload(StringHelper *sh, MB_StringView src, struct server_response_data_t &response, bool getOfs)
     {
         int payloadPos = 0;
         int payloadOfs = 0;
 
-        MB_String out;
+        MB_StringView out;
 
 #if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
 
@@ -888,7 +1028,8 @@ public:
             {
                 FirebaseJson js;
                 FirebaseJsonData d;
-                js.setJsonData(src);
+                MB_String s = src;
+                js.setJsonData(s);
                 js.get(d, pgm2Str(firebase_pgm_str_58 /* "error" */));
                 if (d.success)
                     response.fbError = d.stringValue.c_str();
@@ -938,7 +1079,7 @@ public:
             else if (sh->compare(src, payloadOfs, firebase_pgm_str_59 /* "null" */))
                 response.dataType = firebase_data_type::d_null;
             else
-                setNumDataType(src, payloadOfs, response, src.find(pgm2Str(firebase_pgm_str_5 /* "." */), payloadOfs) != MB_String::npos);
+                setNumDataType(src, payloadOfs, response);
 #endif
         }
     }
@@ -947,20 +1088,19 @@ public:
     {
         if (tokens.length() > 0)
         {
-            MB_VECTOR<MB_String> headers;
+            MB_VECTOR<MB_StringView> headers;
             sh->splitTk(tokens, headers, ",");
             for (size_t i = 0; i < headers.size(); i++)
             {
-                size_t p1 = headers[i].find(F("X-Firebase-"));
+                size_t p1 = headers[i].findP((PGM_P)F("X-Firebase-"));
                 size_t p2 = headers[i].find(':');
-                size_t p3 = headers[i].find(F("-ETag"));
+                size_t p3 = headers[i].findP((PGM_P)F("-ETag"));
 
-                if (p1 != MB_String::npos && p2 != MB_String::npos && p2 > p1 && p3 == MB_String::npos)
+                if (p1 != MB_StringView::npos && p2 != MB_StringView::npos && p2 > p1 && p3 == MB_StringView::npos)
                 {
                     header += headers[i];
                     addNewLine(header);
                 }
-                headers[i].clear();
             }
             headers.clear();
         }
@@ -1019,68 +1159,33 @@ public:
         tcpHandler.defaultChunkSize = defaultChunkSize;
         tcpHandler.bufferAvailable = 0;
         tcpHandler.header.clear();
+        tcpHandler.headerLine.clear();
+        tcpHandler.chunkState.reset();
+        tcpHandler.base64State.reset();
         tcpHandler.dataTime = millis();
         tcpHandler.downloadOTA = isOTA;
         tcpHandler.payload = payload;
     }
 
-    int readLine(Client *client, char *buf, int bufLen)
+    int readLine(Firebase_Buffered_Client *client, char *buf, int bufLen)
     {
         if (!client)
             return 0;
 
-        int res = -1;
-        char c = 0;
-        int idx = 0;
-        if (!client)
-            return idx;
-        while (client->available() && idx < bufLen)
-        {
-            if (!client)
-                break;
-
-            FBUtils::idle();
+        FBUtils::idle();
 
-            res = client->read();
-            if (res > -1)
-            {
-                c = (char)res;
-                buf[idx++] = c;
-                if (c == '\n')
-                    return idx;
-            }
-        }
-        return idx;
+        // scan the line in the receive buffer of the client
+        return client->readLine(buf, bufLen);
     }
 
-    int readLine(Client *client, MB_String &buf)
+    int readLine(Firebase_Buffered_Client *client, MB_String &buf)
     {
         if (!client)
             return 0;
 
-        int res = -1;
-        char c = 0;
-        int idx = 0;
-        if (!client)
-            return idx;
-        while (client->available())
-        {
-            if (!client)
-                break;
-
-            FBUtils::idle();
+        FBUtils::idle();
 
-            res = client->read();
-            if (res > -1)
-            {
-                c = (char)res;
-                buf += c;
-                idx++;
-                if (c == '\n')
-                    return idx;
-            }
-        }
-        return idx;
+        return client->readLine(buf);
     }
 
     uint32_t hex2int(const char *hex)
@@ -1103,123 +1208,22 @@ public:
         return val;
     }
 
-    // Returns -1 when complete
-    int readChunkedData(StringHelper *sh, MB_FS *mbfs, Client *client, char *out1, MB_String *out2,
+    /* Decode the available chunked data from the receive buffer of client, returns FIREBASE_RESPONSE_BODY_END (-1)
+       when the last chunk was read and FIREBASE_RESPONSE_BODY_ERROR (-2) when the chunked data is invalid */
+    int readChunkedData(StringHelper *sh, MB_FS *mbfs, Firebase_Buffered_Client *client, char *out1, MB_String *out2,
                         struct firebase_tcp_response_handler_t &tcpHandler)
     {
-        if (!client)
-            return 0;
-
-        int bufLen = tcpHandler.chunkBufSize;
-        char *buf = nullptr;
-        int p1 = 0;
-        int olen = 0;
-
-        if (tcpHandler.chunkState.state == 0)
-        {
-            tcpHandler.chunkState.state = 1;
-            tcpHandler.chunkState.chunkedSize = -1;
-            tcpHandler.chunkState.dataLen = 0;
-
-            MB_String s;
-            int readLen = 0;
-
-            if (out2)
-                readLen = readLine(client, s);
-            else if (out1)
-            {
-                buf = reinterpret_cast<char *>(mbfs->newP(bufLen));
-                readLen = readLine(client, buf, bufLen);
-            }
-
-            if (readLen)
-            {
-                if (out1)
-                    s = buf;
-
-                p1 = sh->strpos(s.c_str(), (const char *)MBSTRING_FLASH_MCR(";"), 0);
-                if (p1 == -1)
-                    p1 = sh->strpos(s.c_str(), (const char *)MBSTRING_FLASH_MCR("\r\n"), 0);
-
-                if (p1 != -1)
-                {
-                    if (out2)
-                        tcpHandler.chunkState.chunkedSize = hex2int(s.substr(0, p1).c_str());
-                    else if (out1)
-                    {
-                        char *temp = reinterpret_cast<char *>(mbfs->newP(p1 + 1));
-                        memcpy(temp, buf, p1);
-                        tcpHandler.chunkState.chunkedSize = hex2int(temp);
-                        mbfs->delP(&temp);
-                    }
-                }
-
-                // last chunk
-                if (tcpHandler.chunkState.chunkedSize < 1)
-                    olen = -1;
-            }
-            else
-                tcpHandler.chunkState.state = 0;
-
-            if (out1)
-                mbfs->delP(&buf);
-        }
-        else
+        if (out2)
         {
-            if (tcpHandler.chunkState.chunkedSize > -1)
-            {
-                MB_String s;
-                int readLen = 0;
-
-                if (out2)
-                    readLen = readLine(client, s);
-                else if (out1)
-                {
-                    buf = reinterpret_cast<char *>(mbfs->newP(bufLen));
-                    readLen = readLine(client, buf, bufLen);
-                }
-
-                if (readLen > 0)
-                {
-                    // chunk may contain trailing
-                    if (tcpHandler.chunkState.dataLen + readLen - 2 < tcpHandler.chunkState.chunkedSize)
-                    {
-                        tcpHandler.chunkState.dataLen += readLen;
-                        if (out2)
-                            *out2 += s;
-                        else if (out1)
-                            memcpy(out1, buf, readLen);
-
-                        olen = readLen;
-                    }
-                    else
-                    {
-                        if (tcpHandler.chunkState.chunkedSize - tcpHandler.chunkState.dataLen > 0)
-                        {
-                            if (out2)
-                                *out2 += s;
-                            else if (out1)
-                                memcpy(out1, buf, tcpHandler.chunkState.chunkedSize - tcpHandler.chunkState.dataLen);
-                        }
-
-                        tcpHandler.chunkState.dataLen = tcpHandler.chunkState.chunkedSize;
-                        tcpHandler.chunkState.state = 0;
-                        olen = readLen;
-                    }
-                }
-                // if all chunks read, returns -1
-                else if (tcpHandler.chunkState.dataLen == tcpHandler.chunkState.chunkedSize)
-                    olen = -1;
-
-                if (out1)
-                    mbfs->delP(&buf);
-            }
+            Firebase_String_Sink sink(*out2);
+            return Firebase_Response_Pipeline(&sink).read(client, tcpHandler, true, (size_t)-1);
         }
 
-        return olen;
+        Firebase_Buffer_Sink sink(reinterpret_cast<uint8_t *>(out1), out1 ? tcpHandler.chunkBufSize : 0);
+        return Firebase_Response_Pipeline(&sink).read(client, tcpHandler, true, tcpHandler.chunkBufSize);
     }
 
-    bool readStatusLine(StringHelper *sh, MB_FS *mbfs, Client *client, struct firebase_tcp_response_handler_t &tcpHandler,
+    bool readStatusLine(StringHelper *sh, MB_FS *mbfs, Firebase_Buffered_Client *client, struct firebase_tcp_response_handler_t &tcpHandler,
                         struct server_response_data_t &response)
     {
         tcpHandler.chunkIdx++;
@@ -1233,11 +1237,28 @@ public:
         // the first chunk (line) can be http response status or already connected stream payload
         char *hChunk = reinterpret_cast<char *>(mbfs->newP(tcpHandler.chunkBufSize));
         int readLen = readLine(client, hChunk, tcpHandler.chunkBufSize);
-        if (readLen > 0)
-            tcpHandler.header += hChunk;
+        MB_StringView line(hChunk, readLen > 0 ? readLen : 0);
+
+        // the status line was partially read, keep it until the new line was read
+        if (tcpHandler.headerLine.length() > 0 || (readLen > 0 && hChunk[readLen - 1] != '\n' && isStatusLinePrefix(line)))
+        {
+            tcpHandler.headerLine += line;
+            line = tcpHandler.headerLine;
+
+            if (line.length() == 0 || line[line.length() - 1] != '\n')
+            {
+                // read the remaining of the line as the first chunk again
+                tcpHandler.chunkIdx--;
+                mbfs->delP(&hChunk);
+                return true;
+            }
+        }
+
+        if (line.length() > 0)
+            tcpHandler.header += line;
 
         int pos = 0;
-        int status = getStatusCode(sh, hChunk, pos);
+        int status = getStatusCode(sh, line, pos);
         if (status > 0)
         {
             // http response status
@@ -1245,11 +1266,19 @@ public:
             response.httpCode = status;
         }
 
+        tcpHandler.headerLine.clear();
         mbfs->delP(&hChunk);
         return true;
     }
 
-    bool readHeader(StringHelper *sh, MB_FS *mbfs, Client *client, struct firebase_tcp_response_handler_t &tcpHandler,
+    /* The partial line can be the beginning of the http response status line */
+    bool isStatusLinePrefix(MB_StringView line)
+    {
+        size_t len = strlen_P(firebase_pgm_str_53 /* "HTTP/1.1 " */);
+        return strncmp_P(line.data(), firebase_pgm_str_53, line.length() < len ? line.length() : len) == 0;
+    }
+
+    bool readHeader(StringHelper *sh, MB_FS *mbfs, Firebase_Buffered_Client *client, struct firebase_tcp_response_handler_t &tcpHandler,
                     struct server_response_data_t &response)
     {
         // do not check of the config here to allow legacy fcm to work
@@ -1257,23 +1286,76 @@ public:
         char *hChunk = reinterpret_cast<char *>(mbfs->newP(tcpHandler.chunkBufSize));
         int readLen = readLine(client, hChunk, tcpHandler.chunkBufSize);
 
-        // check is it the end of http header (\n or \r\n)?
-        if ((readLen == 1 && hChunk[0] == '\r') || (readLen == 2 && hChunk[0] == '\r' && hChunk[1] == '\n'))
-            tcpHandler.headerEnded = true;
-
-        if (tcpHandler.headerEnded)
+        if (readLen > 0)
         {
-            // parse header string to get the header field
-            tcpHandler.isHeader = false;
-            parseRespHeader(sh, tcpHandler.header, response);
+            MB_StringView line(hChunk, readLen);
+
+            // the line was partially read, keep it until the new line was read
+            if (tcpHandler.headerLine.length() > 0 || hChunk[readLen - 1] != '\n')
+            {
+                tcpHandler.headerLine += line;
+                line = tcpHandler.headerLine;
+            }
+
+            if (line[line.length() - 1] == '\n')
+            {
+                // check is it the end of http header (\n or \r\n)?
+                if (line.trim().empty())
+                {
+                    tcpHandler.headerEnded = true;
+                    tcpHandler.isHeader = false;
+                    parseRespHeaderEnd(response);
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+                    initInflate(sh, tcpHandler, response);
+#endif
+                }
+                // parse the header field as it was read
+                else
+                    parseRespHeaderLine(sh, line, response);
+
+                tcpHandler.headerLine.clear();
+            }
         }
-        // accumulate the remaining header field
-        else if (readLen > 0)
-            tcpHandler.header += hChunk;
 
         mbfs->delP(&hChunk);
         return tcpHandler.headerEnded;
     }
+
+    /* Reserve the payload for the body of known length before its first chunk, the body is appended without reallocation */
+    void reservePayload(MB_String &payload, struct server_response_data_t &response)
+    {
+        // the decoded length of the chunked or compressed body is not known
+        if (response.isChunkedEnc || response.contentLen <= 0 || response.contentEncoding.length() > 0)
+            return;
+
+        payload.reserve(payload.length() + response.contentLen);
+    }
+
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+    /* Prepare the decoder for the payload of the gzip or deflate content encoding or free it when not compressed */
+    void initInflate(StringHelper *sh, struct firebase_tcp_response_handler_t &tcpHandler, struct server_response_data_t &response)
+    {
+        Firebase_Inflate::inflate_format_t format = Firebase_Inflate::inflate_format_gzip;
+        bool compressed = !response.noContent && response.contentEncoding.length() > 0;
+
+        if (compressed && sh->compare(response.contentEncoding, 0, firebase_pgm_str_75 /* "deflate" */))
+            format = Firebase_Inflate::inflate_format_zlib;
+        else if (compressed && !sh->compare(response.contentEncoding, 0, firebase_pgm_str_74 /* "gzip" */))
+            compressed = false;
+
+        if (!compressed)
+        {
+            delete tcpHandler.inflate;
+            tcpHandler.inflate = nullptr;
+            return;
+        }
+
+        if (!tcpHandler.inflate)
+            tcpHandler.inflate = new Firebase_Inflate(format);
+        else
+            tcpHandler.inflate->reset(format);
+    }
+#endif
 };
 
 class Base64Helper
@@ -1607,53 +1689,6 @@ public:
     }
 };
 
-class OtaHelper
-{
-public:
-    // trim double quotes and return pad length
-    int trimLastChunkBase64(MB_String &s, int len)
-    {
-        int padLen = -1;
-        if (len > 1)
-        {
-            if (s[len - 1] == '"')
-            {
-                padLen = 0;
-                if (len > 2)
-                {
-                    if (s[len - 2] == '=')
-                        padLen++;
-                }
-                if (len > 3)
-                {
-                    if (s[len - 3] == '=')
-                        padLen++;
-                }
-                s[len - 1] = 0;
-            }
-        }
-        return padLen;
-    }
-
-    bool decodeBase64OTA(Base64Helper *bh, MB_FS *mbfs, const char *src, size_t len, int &code)
-    {
-        bool ret = true;
-        firebase_base64_io_t<uint8_t> out;
-        uint8_t *buf = reinterpret_cast<uint8_t *>(mbfs->newP(out.bufLen));
-        out.ota = true;
-        out.outT = buf;
-        unsigned char *base64DecBuf = bh->creatBase64DecBuffer(mbfs);
-        if (!bh->decode<uint8_t>(mbfs, base64DecBuf, src, strlen(src), out))
-        {
-            code = FIREBASE_ERROR_FW_UPDATE_WRITE_FAILED;
-            ret = false;
-        }
-        mbfs->delP(&buf);
-        mbfs->delP(&base64DecBuf);
-        return ret;
-    }
-};
-
 class Utils
 {
 public:
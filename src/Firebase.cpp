@@ -40,7 +40,8 @@ FIREBASE_CLASS::FIREBASE_CLASS()
 
 FIREBASE_CLASS::~FIREBASE_CLASS()
 {
-    if (auth)
+    // The user's config and auth data are not deleted, which is the case when the program exits (POSIX host).
+    if (auth && !extConfig)
         delete auth;
     auth = nullptr;
 
@@ -48,7 +49,8 @@ FIREBASE_CLASS::~FIREBASE_CLASS()
     {
         Core.internal.sessions.clear();
         Core.internal.queueSessions.clear();
-        delete config;
+        if (!extConfig)
+            delete config;
         config = nullptr;
     }
 }
@@ -133,8 +135,33 @@ bool FIREBASE_CLASS::ready()
                 fbdo->closeSession();
         }
     }
-    return Core.tokenReady();
+
+    bool ready = Core.tokenReady();
+
+#if !defined(FIREBASE_DISABLE_DNS_CACHE)
+    // renew the cached host address that is about to expire out of the request, the lookup runs in its own task on ESP32
+    if (ready && Core.networkStatus)
+        Core.dnsCache.refresh();
+#endif
+
+    return ready;
+}
+
+#if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
+size_t FIREBASE_CLASS::poll()
+{
+    size_t pending = 0;
+
+    for (size_t id = 0; id < Core.internal.sessions.size(); id++)
+    {
+        FirebaseData *fbdo = addrTo<FirebaseData *>(Core.internal.sessions[id].ptr);
+        if (fbdo)
+            pending += fbdo->poll();
+    }
+
+    return pending;
 }
+#endif
 
 bool FIREBASE_CLASS::authenticated()
 {
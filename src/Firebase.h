@@ -236,6 +236,18 @@ public:
    */
   bool ready();
 
+  /** Read the available responses of the asynchronous requests of all Firebase Data objects without waiting (RTDB only).
+   *
+   * This function should be called repeatedly e.g. in loop() to get the results from the callback function
+   * that was set with <FirebaseData>.setAsyncResultCallback.
+   * The connection, TLS handshake and sending of the requests still block the caller.
+   *
+   * @return The number of the asynchronous requests that are waiting for the response.
+   */
+#if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
+  size_t poll();
+#endif
+
   /** Provide the grant access status for Firebase Services.
    *
    * @return Boolean type status indicates the device can access to the services
@@ -130,6 +130,12 @@
 
 #endif
 
+#elif defined(MB_POSIX_HOST)
+
+// The working directory of POSIX host, see extras/posix/FS.h
+#include <FS.h>
+#define DEFAULT_FLASH_FS PosixFS
+
 #endif
 
 // For ESP32, format SPIFFS or FFat if mounting failed
@@ -200,6 +206,26 @@
  * 🏷️ For debug port assignment.
  * #define FIREBASE_DEFAULT_DEBUG_PORT Serial
  *
+ * 🏷️ For requesting the gzip/deflate compressed response of Firestore, Functions and Storage (except for download)
+ * - The response is decoded while reading and requires the history window (32 KB by default) during the read.
+ * - FIREBASE_INFLATE_WINDOW_SIZE is the window size in bytes (the power of two), the server that compresses
+ *   with larger window than this is not supported.
+ * #define FIREBASE_ENABLE_GZIP_RESPONSE
+ * #define FIREBASE_INFLATE_WINDOW_SIZE 32768
+ *
+ * 🏷️ For the DNS cache of the host addresses which is shared by all FirebaseData objects (on-board WiFi only)
+ * - FIREBASE_DNS_CACHE_TTL and FIREBASE_DNS_CACHE_NEGATIVE_TTL are the seconds to keep the resolved address
+ *   and the failed lookup.
+ * - FIREBASE_DNS_CACHE_PERSIST keeps the cache in RTC memory through deep sleep (ESP32 only).
+ * - The address that is about to expire is renewed in Firebase.ready(), on ESP32 the lookup runs in the task
+ *   with FIREBASE_DNS_CACHE_TASK_STACK_SIZE bytes of stack.
+ * #define FIREBASE_DNS_CACHE_TTL 300
+ * #define FIREBASE_DNS_CACHE_NEGATIVE_TTL 5
+ * #define FIREBASE_DNS_CACHE_PERSIST
+ *
+ * ⛔ Use following build flag to disable the DNS cache.
+ * #define FIREBASE_DISABLE_DNS_CACHE
+ *
  */
 #define ENABLE_ESP8266_ENC28J60_ETH
 
@@ -0,0 +1,161 @@
+/**
+ * Firebase Base64 Decoder v1.0.0
+ *
+ * Created October 19, 2026
+ *
+ * The incremental decoder of the base64 encoded string e.g. the file data in the RTDB response payload.
+ * The input can be split at any position, the decoded data is written to the output buffer.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIREBASE_BASE64_DECODER_H
+#define FIREBASE_BASE64_DECODER_H
+
+#include <Arduino.h>
+#include "./json/MB_String.h"
+
+class Firebase_Base64_Decoder
+{
+public:
+  enum base64_state_t
+  {
+    base64_state_data,
+    base64_state_pad,
+    base64_state_done,
+    base64_state_error
+  };
+
+  void reset()
+  {
+    state = base64_state_data;
+    bits = 0;
+    count = 0;
+    pad = 0;
+  }
+
+  /**
+   * Decode the input until the output buffer is full or the end of the encoded string was found.
+   * The encoded string ends at the double quote (of the JSON string), the pad (=) is optional.
+   * @param in The input.
+   * @param out The output buffer.
+   * @param outSize The size of output buffer, at least 3 bytes.
+   * @param outLen The number of decoded bytes written to the output buffer.
+   * @return The number of input bytes consumed.
+   */
+  size_t decode(MB_StringView in, uint8_t *out, size_t outSize, size_t &outLen)
+  {
+    outLen = 0;
+    size_t pos = 0;
+
+    while (pos < in.length() && state != base64_state_done && state != base64_state_error && outLen + 3 <= outSize)
+    {
+      char c = in[pos++];
+
+      if (c == '\r' || c == '\n')
+        continue;
+
+      if (c == '"')
+      {
+        if (state == base64_state_data)
+          flush(out, outLen);
+        if (state != base64_state_error)
+          state = base64_state_done;
+      }
+      else if (c == '=')
+      {
+        if (state == base64_state_data)
+          flush(out, outLen);
+        if (state != base64_state_error)
+          state = ++pad > 2 ? base64_state_error : base64_state_pad;
+      }
+      else
+      {
+        int v = value(c);
+        // no data after the pad
+        if (v < 0 || state != base64_state_data)
+        {
+          state = base64_state_error;
+          break;
+        }
+
+        bits = (bits << 6) | v;
+        if (++count == 4)
+        {
+          out[outLen++] = (uint8_t)(bits >> 16);
+          out[outLen++] = (uint8_t)(bits >> 8);
+          out[outLen++] = (uint8_t)bits;
+          bits = 0;
+          count = 0;
+        }
+      }
+    }
+
+    return pos;
+  }
+
+  bool done() const { return state == base64_state_done; }
+
+  bool error() const { return state == base64_state_error; }
+
+  /* The number of pad (=) that was found */
+  int padLength() const { return pad; }
+
+private:
+  static int value(char c)
+  {
+    if (c >= 'A' && c <= 'Z')
+      return c - 'A';
+    if (c >= 'a' && c <= 'z')
+      return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+      return c - '0' + 52;
+    if (c == '+' || c == '-')
+      return 62;
+    if (c == '/' || c == '_')
+      return 63;
+    return -1;
+  }
+
+  // The last 2 or 3 characters are decoded to 1 or 2 bytes.
+  void flush(uint8_t *out, size_t &outLen)
+  {
+    if (count == 1)
+      state = base64_state_error;
+    else if (count == 2)
+      out[outLen++] = (uint8_t)(bits >> 4);
+    else if (count == 3)
+    {
+      out[outLen++] = (uint8_t)(bits >> 10);
+      out[outLen++] = (uint8_t)(bits >> 2);
+    }
+    bits = 0;
+    count = 0;
+  }
+
+  base64_state_t state = base64_state_data;
+  uint32_t bits = 0;
+  size_t count = 0;
+  int pad = 0;
+};
+
+#endif /* FIREBASE_BASE64_DECODER_H */
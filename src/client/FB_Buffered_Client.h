@@ -0,0 +1,245 @@
+/**
+ * Firebase Buffered Client v1.0.0
+ *
+ * Created October 19, 2026
+ *
+ * The Client with the receive buffer which is filled in blocks from the underlying client.
+ * The bytes and lines are read from the buffer instead of one underlying read (and SSL engine update) per byte.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIREBASE_BUFFERED_CLIENT_H
+#define FIREBASE_BUFFERED_CLIENT_H
+
+#include <Arduino.h>
+#include <Client.h>
+#include "./json/MB_String.h"
+
+// The size of the receive buffer of the connection, it is allocated on the first read.
+#if !defined(FIREBASE_TCP_RX_BUFFER_SIZE)
+#if defined(ESP8266)
+#define FIREBASE_TCP_RX_BUFFER_SIZE 256
+#else
+#define FIREBASE_TCP_RX_BUFFER_SIZE 512
+#endif
+#endif
+
+class Firebase_Buffered_Client : public Client
+{
+public:
+  virtual ~Firebase_Buffered_Client()
+  {
+    releaseReadBuffer();
+  }
+
+  /**
+   * Get the number of bytes in the receive buffer and the underlying client.
+   * @return The number of bytes available or negative value for error.
+   */
+  int available()
+  {
+    int buffered = _rx_end - _rx_pos;
+    int avail = rawAvailable();
+    if (buffered == 0)
+      return avail;
+    return avail > 0 ? buffered + avail : buffered;
+  }
+
+  /**
+   * Read a byte.
+   * @return The read value or -1 for no data.
+   */
+  int read()
+  {
+    if (_rx_pos == _rx_end && fillReadBuffer() <= 0)
+      return -1;
+    return _rx_buf[_rx_pos++];
+  }
+
+  /**
+   * Read the available bytes up to size, the buffered bytes are copied first and the rest is read
+   * from the underlying client directly.
+   * @param buf The data buffer.
+   * @param size The maximum number of bytes to read.
+   * @return The number of bytes read or negative value for error.
+   */
+  int read(uint8_t *buf, size_t size)
+  {
+    size_t n = _rx_end - _rx_pos;
+    if (n > size)
+      n = size;
+
+    if (n > 0)
+    {
+      memcpy(buf, _rx_buf + _rx_pos, n);
+      _rx_pos += n;
+    }
+
+    if (n < size && rawAvailable() > 0)
+    {
+      int r = rawRead(buf + n, size - n);
+      if (r > 0)
+        n += r;
+      else if (n == 0)
+        return r;
+    }
+
+    return n;
+  }
+
+  int peek()
+  {
+    if (_rx_pos == _rx_end && fillReadBuffer() <= 0)
+      return -1;
+    return _rx_buf[_rx_pos];
+  }
+
+  /**
+   * Get the buffered bytes without consuming, the buffer is filled from the underlying client when it is empty.
+   * @return The view of the buffered bytes, it is valid until the next read.
+   */
+  MB_StringView peekBuffer()
+  {
+    if (_rx_pos == _rx_end && fillReadBuffer() <= 0)
+      return MB_StringView();
+    return MB_StringView((const char *)_rx_buf + _rx_pos, _rx_end - _rx_pos);
+  }
+
+  /**
+   * Remove the bytes from the buffer after they were used through peekBuffer.
+   * @param len The number of bytes to remove.
+   */
+  void consume(size_t len)
+  {
+    _rx_pos = len < _rx_end - _rx_pos ? _rx_pos + len : _rx_end;
+  }
+
+  /**
+   * Read the available bytes to the buffer until new line (included) or bufLen bytes were read.
+   * @param buf The buffer, it is not null terminated.
+   * @param bufLen The size of buffer.
+   * @return The number of bytes read.
+   */
+  int readLine(char *buf, int bufLen)
+  {
+    int idx = 0;
+    while (idx < bufLen && (_rx_pos < _rx_end || fillReadBuffer() > 0))
+    {
+      size_t n = scanLine(bufLen - idx);
+      memcpy(buf + idx, _rx_buf + _rx_pos, n);
+      _rx_pos += n;
+      idx += n;
+      if (buf[idx - 1] == '\n')
+        break;
+    }
+    return idx;
+  }
+
+  /**
+   * Append the available bytes to the string until new line (included).
+   * @param buf The string to append.
+   * @return The number of bytes read.
+   */
+  int readLine(MB_String &buf)
+  {
+    int idx = 0;
+    while (_rx_pos < _rx_end || fillReadBuffer() > 0)
+    {
+      size_t n = scanLine(_rx_end - _rx_pos);
+      buf += MB_StringView((const char *)_rx_buf + _rx_pos, n);
+      _rx_pos += n;
+      idx += n;
+      if (_rx_buf[_rx_pos - 1] == '\n')
+        break;
+    }
+    return idx;
+  }
+
+protected:
+  // The number of bytes available from the underlying client.
+  virtual int rawAvailable() = 0;
+
+  // Read from the underlying client.
+  virtual int rawRead(uint8_t *buf, size_t size) = 0;
+
+  /* Discard the buffered bytes e.g. when the connection was closed or flushed */
+  void clearReadBuffer()
+  {
+    _rx_pos = 0;
+    _rx_end = 0;
+  }
+
+  void releaseReadBuffer()
+  {
+    if (_rx_buf && _rx_buf != &_rx_byte)
+      free(_rx_buf);
+    _rx_buf = nullptr;
+    _rx_cap = 0;
+    clearReadBuffer();
+  }
+
+private:
+  int fillReadBuffer()
+  {
+    clearReadBuffer();
+
+    int avail = rawAvailable();
+    if (avail <= 0)
+      return avail;
+
+    // the allocation is tried again after the one byte fallback as the buffer is empty here
+    if (!_rx_buf || _rx_buf == &_rx_byte)
+    {
+      uint8_t *p = (uint8_t *)malloc(FIREBASE_TCP_RX_BUFFER_SIZE);
+
+      // read one byte for this fill when out of memory
+      _rx_buf = p ? p : &_rx_byte;
+      _rx_cap = p ? FIREBASE_TCP_RX_BUFFER_SIZE : 1;
+    }
+
+    int r = rawRead(_rx_buf, (size_t)avail < _rx_cap ? (size_t)avail : _rx_cap);
+    if (r > 0)
+      _rx_end = r;
+
+    return r;
+  }
+
+  // The number of buffered bytes to take for the line, up to and including the new line.
+  size_t scanLine(size_t limit)
+  {
+    size_t n = _rx_end - _rx_pos;
+    if (n > limit)
+      n = limit;
+
+    const uint8_t *nl = (const uint8_t *)memchr(_rx_buf + _rx_pos, '\n', n);
+    return nl ? nl - (_rx_buf + _rx_pos) + 1 : n;
+  }
+
+  uint8_t *_rx_buf = nullptr;
+  uint8_t _rx_byte = 0;
+  size_t _rx_cap = 0;
+  size_t _rx_pos = 0;
+  size_t _rx_end = 0;
+};
+
+#endif /* FIREBASE_BUFFERED_CLIENT_H */
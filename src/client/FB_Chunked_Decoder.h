@@ -0,0 +1,199 @@
+/**
+ * Firebase Chunked Decoder v1.0.0
+ *
+ * Created October 19, 2026
+ *
+ * The incremental decoder of the HTTP chunked transfer encoding.
+ * The input can be split at any position, the chunk data is returned as views into the input.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIREBASE_CHUNKED_DECODER_H
+#define FIREBASE_CHUNKED_DECODER_H
+
+#include <Arduino.h>
+#include "./json/MB_String.h"
+
+class Firebase_Chunked_Decoder
+{
+public:
+  enum chunk_state_t
+  {
+    chunk_state_size,
+    chunk_state_extension,
+    chunk_state_data,
+    chunk_state_data_end,
+    chunk_state_trailer,
+    chunk_state_done,
+    chunk_state_error
+  };
+
+  void reset()
+  {
+    state = chunk_state_size;
+    size = 0;
+    remaining = 0;
+    digits = 0;
+    lineLen = 0;
+  }
+
+  /**
+   * Decode the input until the chunk data or the end of input was found.
+   * @param in The input.
+   * @param out The view of chunk data in the input, up to maxOut bytes, it is empty if no data was found.
+   * @param maxOut The maximum number of chunk data bytes to return.
+   * @return The number of input bytes consumed.
+   */
+  size_t decode(MB_StringView in, MB_StringView &out, size_t maxOut = (size_t)-1)
+  {
+    out = MB_StringView();
+    size_t pos = 0;
+
+    while (pos < in.length() && state != chunk_state_done && state != chunk_state_error)
+    {
+      char c = in[pos];
+
+      switch (state)
+      {
+      case chunk_state_size:
+        pos++;
+        if (c == '\n')
+          endSizeLine();
+        else if (c == ';' || c == ' ' || c == '\t')
+          state = digits > 0 ? chunk_state_extension : chunk_state_error;
+        else if (c != '\r' && !addDigit(c))
+          state = chunk_state_error;
+        break;
+
+      case chunk_state_extension:
+      {
+        // skip the chunk extension
+        size_t p = in.find('\n', pos);
+        pos = p == MB_StringView::npos ? in.length() : p + 1;
+        if (p != MB_StringView::npos)
+          endSizeLine();
+        break;
+      }
+
+      case chunk_state_data:
+      {
+        size_t n = in.length() - pos;
+        if (n > remaining)
+          n = remaining;
+        if (n > maxOut)
+          n = maxOut;
+
+        out = in.substr(pos, n);
+        pos += n;
+        remaining -= n;
+        if (remaining == 0)
+          state = chunk_state_data_end;
+        return pos;
+      }
+
+      case chunk_state_data_end:
+        pos++;
+        if (c == '\n')
+        {
+          state = chunk_state_size;
+          size = 0;
+        }
+        else if (c != '\r')
+          state = chunk_state_error;
+        break;
+
+      case chunk_state_trailer:
+        pos++;
+        // the empty line ends the trailer fields
+        if (c == '\n')
+        {
+          if (lineLen == 0)
+            state = chunk_state_done;
+          lineLen = 0;
+        }
+        else if (c != '\r')
+          lineLen++;
+        break;
+
+      default:
+        break;
+      }
+    }
+
+    return pos;
+  }
+
+  bool done() const { return state == chunk_state_done; }
+
+  bool error() const { return state == chunk_state_error; }
+
+  /* The size of the current chunk */
+  size_t chunkSize() const { return size; }
+
+private:
+  bool addDigit(char c)
+  {
+    int v = -1;
+    if (c >= '0' && c <= '9')
+      v = c - '0';
+    else if (c >= 'a' && c <= 'f')
+      v = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F')
+      v = c - 'A' + 10;
+
+    // reject the invalid digit and the size that is too large
+    if (v < 0 || size > ((size_t)-1 >> 5))
+      return false;
+
+    size = (size << 4) | v;
+    digits++;
+    return true;
+  }
+
+  void endSizeLine()
+  {
+    if (digits == 0)
+      state = chunk_state_error;
+    else if (size == 0)
+    {
+      // last chunk
+      state = chunk_state_trailer;
+      lineLen = 0;
+    }
+    else
+    {
+      state = chunk_state_data;
+      remaining = size;
+    }
+
+    digits = 0;
+  }
+
+  chunk_state_t state = chunk_state_size;
+  size_t size = 0;
+  size_t remaining = 0;
+  size_t digits = 0;
+  size_t lineLen = 0;
+};
+
+#endif /* FIREBASE_CHUNKED_DECODER_H */
@@ -0,0 +1,404 @@
+/**
+ * Firebase DNS Cache v1.0.0
+ *
+ * Created October 19, 2026
+ *
+ * The host name to IP address cache which is shared by all connections.
+ * The resolved address is kept for FIREBASE_DNS_CACHE_TTL seconds and the failed lookup for
+ * FIREBASE_DNS_CACHE_NEGATIVE_TTL seconds, the address that is about to expire is renewed by refresh()
+ * which is called out of the request.
+ *
+ * The cache is shared by the stream and the loop tasks on ESP32, the entries and the clock are guarded
+ * by the mutex which is not held during the lookup. The lookups are made one at a time as the host name
+ * lookup of the Arduino cores is not reentrant.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIREBASE_DNS_CACHE_H
+#define FIREBASE_DNS_CACHE_H
+
+#include <Arduino.h>
+#include <Client.h>
+#include <time.h>
+#include "./mbfs/MB_MCU.h"
+
+#if defined(MB_POSIX_HOST)
+#include <mutex>
+#endif
+
+// The number of hosts in the cache.
+#if !defined(FIREBASE_DNS_CACHE_SIZE)
+#define FIREBASE_DNS_CACHE_SIZE 4
+#endif
+
+// The maximum length of host name to cache (included the null terminator).
+#if !defined(FIREBASE_DNS_CACHE_HOST_LENGTH)
+#define FIREBASE_DNS_CACHE_HOST_LENGTH 96
+#endif
+
+// The seconds to keep the resolved address, the record TTL is not available from the Arduino resolvers.
+#if !defined(FIREBASE_DNS_CACHE_TTL)
+#define FIREBASE_DNS_CACHE_TTL 300
+#endif
+
+// The seconds to keep the failed lookup.
+#if !defined(FIREBASE_DNS_CACHE_NEGATIVE_TTL)
+#define FIREBASE_DNS_CACHE_NEGATIVE_TTL 5
+#endif
+
+// The seconds before expiry that refresh() renews the address.
+#if !defined(FIREBASE_DNS_CACHE_REFRESH_AHEAD)
+#define FIREBASE_DNS_CACHE_REFRESH_AHEAD 60
+#endif
+
+// The stack size of the task that renews the address on ESP32.
+#if !defined(FIREBASE_DNS_CACHE_TASK_STACK_SIZE)
+#define FIREBASE_DNS_CACHE_TASK_STACK_SIZE 4096
+#endif
+
+// The entries are kept in RTC memory through deep sleep, the RTC clock is used as the cache clock.
+#if defined(FIREBASE_DNS_CACHE_PERSIST) && defined(ESP32)
+#define FIREBASE_DNS_CACHE_ATTR RTC_DATA_ATTR
+#define FIREBASE_DNS_CACHE_RTC
+#else
+#define FIREBASE_DNS_CACHE_ATTR
+#endif
+
+/**
+ * The host name resolver.
+ * @param name The host name.
+ * @param ip The ip address result.
+ * @return 1 for success or 0 for failed.
+ */
+typedef int (*Firebase_DNS_Resolver)(const char *name, IPAddress &ip);
+
+struct firebase_dns_cache_entry_t
+{
+  // the empty host is the unused entry
+  char host[FIREBASE_DNS_CACHE_HOST_LENGTH];
+  // the zero address is the failed lookup
+  uint32_t addr;
+  uint32_t expires;
+  uint32_t used;
+  // the next time that refresh() can try this entry
+  uint32_t retry;
+};
+
+class Firebase_DNS_Cache
+{
+public:
+  /**
+   * @param entries The array of FIREBASE_DNS_CACHE_SIZE entries, it is not cleared
+   * so that the entries can be restored from RTC memory.
+   */
+  Firebase_DNS_Cache(firebase_dns_cache_entry_t *entries) : entries(entries)
+  {
+#if defined(ESP32)
+    mutex = xSemaphoreCreateMutex();
+    lookupMutex = xSemaphoreCreateMutex();
+#endif
+  }
+
+  void setResolver(Firebase_DNS_Resolver resolver) { this->resolver = resolver; }
+
+  Firebase_DNS_Resolver getResolver() const { return resolver; }
+
+  /**
+   * Get the address of host from the cache or the resolver when it was not cached or expired.
+   * @param host The host name.
+   * @param ip The ip address result.
+   * @return true when the address was found, false when the lookup failed now or recently.
+   */
+  bool resolve(const char *host, IPAddress &ip)
+  {
+    bool found = false;
+
+    lock();
+    uint32_t t = now();
+    firebase_dns_cache_entry_t *e = find(host);
+    bool cached = e && alive(e->expires, t);
+
+    if (cached)
+    {
+      e->used = t;
+      found = e->addr != 0;
+      if (found)
+        ip = IPAddress(e->addr);
+    }
+    unlock();
+
+    if (cached || !resolver)
+      return found;
+
+    IPAddress res;
+    bool ok = lookup(host, res);
+
+    lock();
+    // the entry may be changed or taken by the other host during the lookup
+    t = now();
+    e = find(host);
+
+    // the expired address is still used for a while when the lookup failed
+    if (!ok && e && e->addr != 0)
+    {
+      e->expires = t + FIREBASE_DNS_CACHE_NEGATIVE_TTL;
+      e->used = t;
+      ip = IPAddress(e->addr);
+      found = true;
+    }
+    else
+    {
+      if (!e)
+        e = add(host);
+
+      if (e)
+      {
+        e->addr = ok ? (uint32_t)res : 0;
+        e->expires = t + (ok ? FIREBASE_DNS_CACHE_TTL : FIREBASE_DNS_CACHE_NEGATIVE_TTL);
+        e->used = t;
+        e->retry = t;
+      }
+
+      if (ok)
+        ip = res;
+      found = ok;
+    }
+    unlock();
+
+    return found;
+  }
+
+  /**
+   * Remove the address of host e.g. when it can't be connected, the failed lookup is kept.
+   * @param host The host name.
+   */
+  void invalidate(const char *host)
+  {
+    lock();
+    firebase_dns_cache_entry_t *e = find(host);
+    if (e && e->addr != 0)
+      e->host[0] = 0;
+    unlock();
+  }
+
+  /**
+   * Renew one address that is about to expire, it should be called when there is no request in progress.
+   * The address that was not used within FIREBASE_DNS_CACHE_TTL seconds is left to expire.
+   * On ESP32, the lookup runs in its own task and this returns immediately, on other devices the lookup
+   * blocks as long as the host name lookup.
+   */
+  void refresh()
+  {
+    if (!resolver)
+      return;
+
+#if defined(ESP32)
+    lock();
+    bool start = !refreshing && due(now());
+    refreshing |= start;
+    unlock();
+
+    if (!start)
+      return;
+
+    TaskFunction_t taskCode = [](void *param)
+    {
+      Firebase_DNS_Cache *cache = (Firebase_DNS_Cache *)param;
+      cache->renew();
+      cache->lock();
+      cache->refreshing = false;
+      cache->unlock();
+      vTaskDelete(NULL);
+    };
+
+    if (xTaskCreatePinnedToCore(taskCode, "DNS_Refresh", FIREBASE_DNS_CACHE_TASK_STACK_SIZE, this, 1, NULL, 1) != pdPASS)
+    {
+      lock();
+      refreshing = false;
+      unlock();
+    }
+#else
+    renew();
+#endif
+  }
+
+  void clear()
+  {
+    lock();
+    memset(entries, 0, sizeof(firebase_dns_cache_entry_t) * FIREBASE_DNS_CACHE_SIZE);
+    unlock();
+  }
+
+private:
+  // Renew the address of one entry that is due.
+  void renew()
+  {
+    char host[FIREBASE_DNS_CACHE_HOST_LENGTH];
+
+    lock();
+    uint32_t t = now();
+    firebase_dns_cache_entry_t *e = due(t);
+    if (e)
+    {
+      memcpy(host, e->host, sizeof(host));
+      // the entry is not taken again while it is being renewed and after the failed lookup
+      e->retry = t + FIREBASE_DNS_CACHE_NEGATIVE_TTL;
+    }
+    unlock();
+
+    if (!e)
+      return;
+
+    IPAddress res;
+    if (!lookup(host, res))
+      return;
+
+    lock();
+    e = find(host);
+    if (e)
+    {
+      e->addr = (uint32_t)res;
+      e->expires = now() + FIREBASE_DNS_CACHE_TTL;
+    }
+    unlock();
+  }
+
+  // The entry that was used recently and its address is about to expire.
+  firebase_dns_cache_entry_t *due(uint32_t t)
+  {
+    for (size_t i = 0; i < FIREBASE_DNS_CACHE_SIZE; i++)
+    {
+      firebase_dns_cache_entry_t *e = &entries[i];
+      if (e->host[0] == 0 || e->addr == 0 || !alive(e->expires, t) || alive(e->retry, t) ||
+          alive(e->expires, t + FIREBASE_DNS_CACHE_REFRESH_AHEAD) || t - e->used > FIREBASE_DNS_CACHE_TTL)
+        continue;
+      return e;
+    }
+    return nullptr;
+  }
+
+  bool lookup(const char *host, IPAddress &res)
+  {
+#if defined(ESP32)
+    if (lookupMutex)
+      xSemaphoreTake(lookupMutex, portMAX_DELAY);
+#elif defined(MB_POSIX_HOST)
+    lookupMutex.lock();
+#endif
+
+    bool ok = resolver(host, res) && (uint32_t)res != 0;
+
+#if defined(ESP32)
+    if (lookupMutex)
+      xSemaphoreGive(lookupMutex);
+#elif defined(MB_POSIX_HOST)
+    lookupMutex.unlock();
+#endif
+    return ok;
+  }
+
+  void lock()
+  {
+#if defined(ESP32)
+    if (mutex)
+      xSemaphoreTake(mutex, portMAX_DELAY);
+#elif defined(MB_POSIX_HOST)
+    mutex.lock();
+#endif
+  }
+
+  void unlock()
+  {
+#if defined(ESP32)
+    if (mutex)
+      xSemaphoreGive(mutex);
+#elif defined(MB_POSIX_HOST)
+    mutex.unlock();
+#endif
+  }
+
+  // The cache clock in seconds.
+  uint32_t now()
+  {
+#if defined(FIREBASE_DNS_CACHE_RTC)
+    return (uint32_t)time(nullptr);
+#else
+    // count the seconds here as millis() / 1000 does not wrap at 32 bits
+    unsigned long ms = millis() - lastMs;
+    seconds += ms / 1000;
+    lastMs += ms - ms % 1000;
+    return seconds;
+#endif
+  }
+
+  static bool alive(uint32_t expires, uint32_t t) { return (int32_t)(expires - t) > 0; }
+
+  firebase_dns_cache_entry_t *find(const char *host)
+  {
+    for (size_t i = 0; i < FIREBASE_DNS_CACHE_SIZE; i++)
+    {
+      // the entry restored from RTC memory may not be terminated
+      if (entries[i].host[FIREBASE_DNS_CACHE_HOST_LENGTH - 1] != 0)
+        entries[i].host[0] = 0;
+      else if (entries[i].host[0] != 0 && strcasecmp(entries[i].host, host) == 0)
+        return &entries[i];
+    }
+    return nullptr;
+  }
+
+  // Take the unused or the least recently used entry.
+  firebase_dns_cache_entry_t *add(const char *host)
+  {
+    size_t len = strlen(host);
+    if (len == 0 || len >= FIREBASE_DNS_CACHE_HOST_LENGTH)
+      return nullptr;
+
+    uint32_t t = now();
+    firebase_dns_cache_entry_t *e = &entries[0];
+    for (size_t i = 0; i < FIREBASE_DNS_CACHE_SIZE && e->host[0] != 0; i++)
+    {
+      if (entries[i].host[0] == 0 || t - entries[i].used > t - e->used)
+        e = &entries[i];
+    }
+
+    memcpy(e->host, host, len + 1);
+    return e;
+  }
+
+  firebase_dns_cache_entry_t *entries = nullptr;
+  Firebase_DNS_Resolver resolver = nullptr;
+#if !defined(FIREBASE_DNS_CACHE_RTC)
+  uint32_t seconds = 0;
+  unsigned long lastMs = 0;
+#endif
+#if defined(ESP32)
+  SemaphoreHandle_t mutex = NULL;
+  SemaphoreHandle_t lookupMutex = NULL;
+  bool refreshing = false;
+#elif defined(MB_POSIX_HOST)
+  std::mutex mutex;
+  std::mutex lookupMutex;
+#endif
+};
+
+#endif /* FIREBASE_DNS_CACHE_H */
@@ -0,0 +1,708 @@
+/**
+ * Firebase Inflate v1.0.0
+ *
+ * Created October 19, 2026
+ *
+ * The incremental decoder of the deflate (RFC 1951) stream in the gzip (RFC 1952), zlib (RFC 1950)
+ * or raw format for the compressed response body.
+ * The input can be split at any position, the decoded data is returned as views into the history window.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2022 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIREBASE_INFLATE_H
+#define FIREBASE_INFLATE_H
+
+#include <Arduino.h>
+#include "./json/MB_String.h"
+
+// The size of the history window, it is allocated on the first decode.
+// The stream that refers back further than this is rejected, the full 32 KB window is required
+// for any deflate stream, the smaller window only works with the servers that compress with it.
+#if !defined(FIREBASE_INFLATE_WINDOW_SIZE)
+#define FIREBASE_INFLATE_WINDOW_SIZE 32768
+#endif
+
+#if (FIREBASE_INFLATE_WINDOW_SIZE & (FIREBASE_INFLATE_WINDOW_SIZE - 1)) != 0 || FIREBASE_INFLATE_WINDOW_SIZE < 256
+#error "FIREBASE_INFLATE_WINDOW_SIZE should be the power of two and at least 256"
+#endif
+
+static const uint16_t firebase_inflate_len_base[29] PROGMEM = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                                               35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t firebase_inflate_len_extra[29] PROGMEM = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                                               3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t firebase_inflate_dist_base[30] PROGMEM = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                                                257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                                                8193, 12289, 16385, 24577};
+static const uint8_t firebase_inflate_dist_extra[30] PROGMEM = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                                                7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+// The order of the code length code lengths
+static const uint8_t firebase_inflate_clen_order[19] PROGMEM = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+static const uint32_t firebase_inflate_crc_table[16] PROGMEM = {0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+                                                                0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+                                                                0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+                                                                0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+class Firebase_Inflate
+{
+public:
+  enum inflate_format_t
+  {
+    inflate_format_raw,
+    inflate_format_zlib,
+    inflate_format_gzip
+  };
+
+  enum inflate_state_t
+  {
+    inflate_state_gzip_header,
+    inflate_state_gzip_extra_len,
+    inflate_state_gzip_extra,
+    inflate_state_gzip_name,
+    inflate_state_gzip_comment,
+    inflate_state_gzip_hcrc,
+    inflate_state_zlib_header,
+    inflate_state_block_header,
+    inflate_state_stored_len,
+    inflate_state_stored,
+    inflate_state_dynamic_header,
+    inflate_state_code_lens,
+    inflate_state_lens,
+    inflate_state_lens_repeat,
+    inflate_state_codes,
+    inflate_state_len_extra,
+    inflate_state_dist,
+    inflate_state_dist_extra,
+    inflate_state_copy,
+    inflate_state_trailer,
+    inflate_state_done,
+    inflate_state_error
+  };
+
+  Firebase_Inflate(inflate_format_t format = inflate_format_gzip) : format(format)
+  {
+    reset();
+  }
+
+  ~Firebase_Inflate()
+  {
+    if (window)
+      free(window);
+  }
+
+  /* Start the new stream in the format, the window is kept for reuse */
+  void reset(inflate_format_t format)
+  {
+    this->format = format;
+    reset();
+  }
+
+  /* Start the new stream, the window is kept for reuse */
+  void reset()
+  {
+    state = format == inflate_format_gzip   ? inflate_state_gzip_header
+            : format == inflate_format_zlib ? inflate_state_zlib_header
+                                            : inflate_state_block_header;
+    bitBuf = 0;
+    bitCount = 0;
+    pos = 0;
+    flushed = 0;
+    total = 0;
+    count = 0;
+    value = 0;
+    last = false;
+    crc = 0xffffffff;
+    adlerA = 1;
+    adlerB = 0;
+  }
+
+  /**
+   * Decode the input until the end of input, the window is full or the end of stream.
+   * The decoded data of the previous call is dropped from the window on each call.
+   * @param in The input.
+   * @param out The view of the decoded data in the window, it is empty if no data was decoded.
+   * @return The number of input bytes consumed.
+   */
+  size_t decode(MB_StringView in, MB_StringView &out)
+  {
+    out = MB_StringView();
+    input = (const uint8_t *)in.data();
+    inputLen = in.length();
+    inputPos = 0;
+
+    if (pos == FIREBASE_INFLATE_WINDOW_SIZE)
+      pos = 0;
+    flushed = pos;
+
+    if (!window && state != inflate_state_done && state != inflate_state_error)
+    {
+      window = (uint8_t *)malloc(FIREBASE_INFLATE_WINDOW_SIZE);
+      if (!window)
+        state = inflate_state_error;
+    }
+
+    while (state != inflate_state_done && state != inflate_state_error && pos < FIREBASE_INFLATE_WINDOW_SIZE)
+    {
+      if (!step())
+        break;
+    }
+
+    if (pos > flushed)
+    {
+      updateChecksum(window + flushed, pos - flushed);
+      out = MB_StringView((const char *)window + flushed, pos - flushed);
+    }
+
+    return inputPos;
+  }
+
+  bool done() const { return state == inflate_state_done; }
+
+  bool error() const { return state == inflate_state_error; }
+
+  /* The number of decoded bytes */
+  size_t length() const { return total; }
+
+private:
+  Firebase_Inflate(const Firebase_Inflate &);
+  Firebase_Inflate &operator=(const Firebase_Inflate &);
+
+  // Run one state, return false when more input is required or the decoded data should be returned first.
+  bool step()
+  {
+    int c = 0;
+
+    switch (state)
+    {
+    case inflate_state_gzip_header:
+      // ID1, ID2, CM, FLG, MTIME (4), XFL, OS
+      while (count < 10)
+      {
+        if ((c = getByte()) < 0)
+          return false;
+        if ((count == 0 && c != 0x1f) || (count == 1 && c != 0x8b) || (count == 2 && c != 8))
+          return fail();
+        if (count == 3)
+          flags = c;
+        count++;
+      }
+      count = 0;
+      state = inflate_state_gzip_extra_len;
+      break;
+
+    case inflate_state_gzip_extra_len:
+      if (flags & 0x04)
+      {
+        while (count < 2)
+        {
+          if ((c = getByte()) < 0)
+            return false;
+          value |= (uint32_t)c << (count++ * 8);
+        }
+      }
+      count = 0;
+      state = inflate_state_gzip_extra;
+      break;
+
+    case inflate_state_gzip_extra:
+      for (; value > 0; value--)
+      {
+        if (getByte() < 0)
+          return false;
+      }
+      state = inflate_state_gzip_name;
+      break;
+
+    case inflate_state_gzip_name:
+    case inflate_state_gzip_comment:
+      // the zero terminated file name and comment
+      if (flags & (state == inflate_state_gzip_name ? 0x08 : 0x10))
+      {
+        do
+        {
+          if ((c = getByte()) < 0)
+            return false;
+        } while (c != 0);
+      }
+      state = state == inflate_state_gzip_name ? inflate_state_gzip_comment : inflate_state_gzip_hcrc;
+      break;
+
+    case inflate_state_gzip_hcrc:
+      if (flags & 0x02)
+      {
+        while (count < 2)
+        {
+          if (getByte() < 0)
+            return false;
+          count++;
+        }
+      }
+      count = 0;
+      state = inflate_state_block_header;
+      break;
+
+    case inflate_state_zlib_header:
+    {
+      if (!needBits(16))
+        return false;
+      uint32_t cmf = getBits(8), flg = getBits(8);
+      // deflate method without the preset dictionary
+      if ((cmf & 0x0f) != 8 || (cmf >> 4) > 7 || ((cmf << 8) | flg) % 31 != 0 || (flg & 0x20))
+        return fail();
+      state = inflate_state_block_header;
+      break;
+    }
+
+    case inflate_state_block_header:
+    {
+      if (!needBits(3))
+        return false;
+      last = getBits(1);
+      uint32_t type = getBits(2);
+      if (type == 0)
+      {
+        // the stored block starts at the byte boundary
+        getBits(bitCount & 7);
+        state = inflate_state_stored_len;
+      }
+      else if (type == 1)
+      {
+        buildFixed();
+        state = inflate_state_codes;
+      }
+      else if (type == 2)
+        state = inflate_state_dynamic_header;
+      else
+        return fail();
+      break;
+    }
+
+    case inflate_state_stored_len:
+    {
+      if (!needBits(32))
+        return false;
+      uint32_t len = getBits(16);
+      if (len != (~getBits(16) & 0xffff))
+        return fail();
+      value = len;
+      state = inflate_state_stored;
+      break;
+    }
+
+    case inflate_state_stored:
+      while (value > 0)
+      {
+        // the bit buffer is empty here, copy from the input directly
+        size_t n = inputLen - inputPos;
+        if (n > value)
+          n = value;
+        if (n > FIREBASE_INFLATE_WINDOW_SIZE - pos)
+          n = FIREBASE_INFLATE_WINDOW_SIZE - pos;
+        if (n == 0)
+          return false;
+        memcpy(window + pos, input + inputPos, n);
+        inputPos += n;
+        pos += n;
+        total += n;
+        value -= n;
+      }
+      endBlock();
+      break;
+
+    case inflate_state_dynamic_header:
+      if (!needBits(14))
+        return false;
+      litCount = getBits(5) + 257;
+      distCount = getBits(5) + 1;
+      value = getBits(4) + 4;
+      if (litCount > 286 || distCount > 30)
+        return fail();
+      memset(lens, 0, 19);
+      count = 0;
+      state = inflate_state_code_lens;
+      break;
+
+    case inflate_state_code_lens:
+      while (count < value)
+      {
+        if (!needBits(3))
+          return false;
+        lens[pgm_read_byte(&firebase_inflate_clen_order[count++])] = getBits(3);
+      }
+      // the code length codes are decoded with the literal/length table
+      if (!build(litCounts, litSymbols, lens, 19))
+        return fail();
+      count = 0;
+      state = inflate_state_lens;
+      break;
+
+    case inflate_state_lens:
+      while (count < litCount + distCount)
+      {
+        int sym = decodeSymbol(litCounts, litSymbols);
+        if (sym < 0)
+          return sym == -1 ? false : fail();
+
+        if (sym < 16)
+          lens[count++] = sym;
+        else
+        {
+          if (sym == 16 && count == 0)
+            return fail();
+          value = sym;
+          state = inflate_state_lens_repeat;
+          return true;
+        }
+      }
+
+      if (lens[256] == 0 || !build(litCounts, litSymbols, lens, litCount) ||
+          !build(distCounts, distSymbols, lens + litCount, distCount))
+        return fail();
+      state = inflate_state_codes;
+      break;
+
+    case inflate_state_lens_repeat:
+    {
+      // 16: repeat the previous length 3 - 6 times, 17: 3 - 10 zeros, 18: 11 - 138 zeros
+      int bits = value == 16 ? 2 : value == 17 ? 3 : 7;
+      if (!needBits(bits))
+        return false;
+      uint32_t n = getBits(bits) + (value == 18 ? 11 : 3);
+      uint8_t len = value == 16 ? lens[count - 1] : 0;
+      if (count + n > litCount + distCount)
+        return fail();
+      while (n-- > 0)
+        lens[count++] = len;
+      state = inflate_state_lens;
+      break;
+    }
+
+    case inflate_state_codes:
+      while (pos < FIREBASE_INFLATE_WINDOW_SIZE)
+      {
+        int sym = decodeSymbol(litCounts, litSymbols);
+        if (sym < 0)
+          return sym == -1 ? false : fail();
+
+        if (sym < 256)
+        {
+          window[pos++] = sym;
+          total++;
+        }
+        else if (sym == 256)
+        {
+          endBlock();
+          return true;
+        }
+        else
+        {
+          sym -= 257;
+          if (sym >= 29)
+            return fail();
+          value = sym;
+          state = inflate_state_len_extra;
+          return true;
+        }
+      }
+      return false;
+
+    case inflate_state_len_extra:
+    {
+      int bits = pgm_read_byte(&firebase_inflate_len_extra[value]);
+      if (!needBits(bits))
+        return false;
+      matchLen = pgm_read_word(&firebase_inflate_len_base[value]) + getBits(bits);
+      state = inflate_state_dist;
+      break;
+    }
+
+    case inflate_state_dist:
+    {
+      int sym = decodeSymbol(distCounts, distSymbols);
+      if (sym < 0)
+        return sym == -1 ? false : fail();
+      if (sym >= 30)
+        return fail();
+      value = sym;
+      state = inflate_state_dist_extra;
+      break;
+    }
+
+    case inflate_state_dist_extra:
+    {
+      int bits = pgm_read_byte(&firebase_inflate_dist_extra[value]);
+      if (!needBits(bits))
+        return false;
+      matchDist = pgm_read_word(&firebase_inflate_dist_base[value]) + getBits(bits);
+      // the distance should be inside the window and the decoded data
+      if (matchDist > FIREBASE_INFLATE_WINDOW_SIZE || matchDist > total)
+        return fail();
+      state = inflate_state_copy;
+      break;
+    }
+
+    case inflate_state_copy:
+      while (matchLen > 0)
+      {
+        if (pos == FIREBASE_INFLATE_WINDOW_SIZE)
+          return false;
+        window[pos] = window[(pos - matchDist) & (FIREBASE_INFLATE_WINDOW_SIZE - 1)];
+        pos++;
+        total++;
+        matchLen--;
+      }
+      state = inflate_state_codes;
+      break;
+
+    case inflate_state_trailer:
+      // return the decoded data first, the checksum is updated when it is returned
+      if (pos > flushed)
+        return false;
+
+      if (format == inflate_format_raw)
+      {
+        state = inflate_state_done;
+        break;
+      }
+
+      // the trailer starts at the byte boundary
+      if (count == 0)
+        getBits(bitCount & 7);
+
+      // gzip: CRC32 and ISIZE (LSB first), zlib: Adler-32 (MSB first)
+      while (count < (format == inflate_format_gzip ? 8u : 4u))
+      {
+        if ((c = getByte()) < 0)
+          return false;
+
+        if (format == inflate_format_gzip)
+        {
+          if (count == 0 || count == 4)
+            value = 0;
+          value |= (uint32_t)c << ((count & 3) * 8);
+          if ((count == 3 && value != ~crc) || (count == 7 && value != (uint32_t)total))
+            return fail();
+        }
+        else
+        {
+          value = (value << 8) | c;
+          if (count == 3 && value != ((adlerB << 16) | adlerA))
+            return fail();
+        }
+        count++;
+      }
+      state = inflate_state_done;
+      break;
+
+    default:
+      return false;
+    }
+
+    return true;
+  }
+
+  void endBlock()
+  {
+    if (last)
+    {
+      state = inflate_state_trailer;
+      count = 0;
+      value = 0;
+    }
+    else
+      state = inflate_state_block_header;
+  }
+
+  bool fail()
+  {
+    state = inflate_state_error;
+    return false;
+  }
+
+  bool needBits(int n)
+  {
+    while (bitCount < n)
+    {
+      if (inputPos == inputLen)
+        return false;
+      bitBuf |= (uint32_t)input[inputPos++] << bitCount;
+      bitCount += 8;
+    }
+    return true;
+  }
+
+  uint32_t getBits(int n)
+  {
+    uint32_t v = n < 32 ? bitBuf & ((1UL << n) - 1) : bitBuf;
+    bitBuf = n < 32 ? bitBuf >> n : 0;
+    bitCount -= n;
+    return v;
+  }
+
+  int getByte()
+  {
+    if (bitCount >= 8)
+      return getBits(8);
+    return inputPos < inputLen ? input[inputPos++] : -1;
+  }
+
+  /**
+   * Build the canonical Huffman table from the code lengths.
+   * @return false when the code is over-subscribed.
+   */
+  bool build(uint16_t *counts, uint16_t *symbols, const uint8_t *lengths, int num)
+  {
+    uint16_t offs[16];
+    memset(counts, 0, 16 * sizeof(uint16_t));
+
+    for (int i = 0; i < num; i++)
+      counts[lengths[i]]++;
+    counts[0] = 0;
+
+    int left = 1;
+    for (int i = 1; i < 16; i++)
+    {
+      left = (left << 1) - counts[i];
+      if (left < 0)
+        return false;
+    }
+
+    offs[0] = 0;
+    for (int i = 1; i < 16; i++)
+      offs[i] = offs[i - 1] + counts[i - 1];
+
+    for (int i = 0; i < num; i++)
+    {
+      if (lengths[i])
+        symbols[offs[lengths[i]]++] = i;
+    }
+
+    return true;
+  }
+
+  void buildFixed()
+  {
+    for (int i = 0; i < 288; i++)
+      lens[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+    build(litCounts, litSymbols, lens, 288);
+
+    for (int i = 0; i < 30; i++)
+      lens[i] = 5;
+    build(distCounts, distSymbols, lens, 30);
+  }
+
+  /**
+   * Decode the symbol, the bits are consumed only when the whole code is available.
+   * @return The symbol, -1 for more input is required or -2 for the invalid code.
+   */
+  int decodeSymbol(const uint16_t *counts, const uint16_t *symbols)
+  {
+    int code = 0, first = 0, index = 0;
+
+    for (int len = 1; len < 16; len++)
+    {
+      if (!needBits(len))
+        return -1;
+
+      code |= (bitBuf >> (len - 1)) & 1;
+      int n = counts[len];
+      if (code - first < n)
+      {
+        getBits(len);
+        return symbols[index + code - first];
+      }
+      index += n;
+      first = (first + n) << 1;
+      code <<= 1;
+    }
+
+    return -2;
+  }
+
+  void updateChecksum(const uint8_t *data, size_t len)
+  {
+    if (format == inflate_format_gzip)
+    {
+      for (size_t i = 0; i < len; i++)
+      {
+        crc ^= data[i];
+        crc = pgm_read_dword(&firebase_inflate_crc_table[crc & 0x0f]) ^ (crc >> 4);
+        crc = pgm_read_dword(&firebase_inflate_crc_table[crc & 0x0f]) ^ (crc >> 4);
+      }
+    }
+    else if (format == inflate_format_zlib)
+    {
+      while (len > 0)
+      {
+        // defer the modulo while the sums can't overflow
+        size_t n = len < 5552 ? len : 5552;
+        len -= n;
+        while (n-- > 0)
+        {
+          adlerA += *data++;
+          adlerB += adlerA;
+        }
+        adlerA %= 65521;
+        adlerB %= 65521;
+      }
+    }
+  }
+
+  inflate_format_t format = inflate_format_gzip;
+  inflate_state_t state = inflate_state_gzip_header;
+
+  const uint8_t *input = nullptr;
+  size_t inputLen = 0;
+  size_t inputPos = 0;
+
+  uint32_t bitBuf = 0;
+  int bitCount = 0;
+
+  // The history window, the decoded data from flushed to pos is returned to the caller.
+  uint8_t *window = nullptr;
+  size_t pos = 0;
+  size_t flushed = 0;
+  size_t total = 0;
+
+  // The state specific counter and value.
+  uint32_t count = 0;
+  uint32_t value = 0;
+  uint8_t flags = 0;
+  bool last = false;
+
+  uint32_t litCount = 0;
+  uint32_t distCount = 0;
+  uint32_t matchLen = 0;
+  uint32_t matchDist = 0;
+
+  uint16_t litCounts[16];
+  uint16_t litSymbols[288];
+  uint16_t distCounts[16];
+  uint16_t distSymbols[30];
+  uint8_t lens[288 + 32];
+
+  uint32_t crc = 0xffffffff;
+  uint32_t adlerA = 1;
+  uint32_t adlerB = 0;
+};
+
+#endif /* FIREBASE_INFLATE_H */
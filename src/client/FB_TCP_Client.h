@@ -1,7 +1,7 @@
 /**
- * Firebase TCP Client v1.0.5
+ * Firebase TCP Client v1.0.6
  *
- * Created December 27, 2024
+ * Created October 19, 2026
  *
  * The MIT License (MIT)
  * Copyright (c) 2022 K. Suwatchai (Mobizt)
@@ -32,6 +32,10 @@
 #include "./FB_Const.h"
 #include "./mbfs/MB_FS.h"
 #include "./FB_Utils.h"
+#include "./client/FB_Buffered_Client.h"
+#if !defined(FIREBASE_DISABLE_DNS_CACHE)
+#include "./client/FB_DNS_Cache.h"
+#endif
 #if __has_include(<ESP_SSLClient.h>)
 #include <ESP_SSLClient.h>
 #else
@@ -50,6 +54,8 @@
 #elif defined(FIREBASE_WIFI_IS_AVAILABLE)
 #include "WiFiClient.h"
 #define BASE_WIFICLIENT WiFiClient
+#elif defined(FIREBASE_POSIX_SOCKET)
+#include "WiFiClientImpl.h"
 #endif
 
 #pragma GCC diagnostic ignored "-Wdelete-non-virtual-dtor"
@@ -87,7 +93,7 @@ private:
   bool optional = false;
 } Firebase_StaticIP;
 
-class Firebase_TCP_Client : public Client
+class Firebase_TCP_Client : public Firebase_Buffered_Client
 {
   friend class FirebaseCore;
 
@@ -496,15 +502,17 @@ public:
   }
 
   /**
-   * Set Root CA certificate to verify.
+   * Resolve the host name.
    * @param name The host name.
    * @param ip The ip address result.
    * @return 1 for success or 0 for failed.
    */
-  int hostByName(const char *name, IPAddress &ip)
+  static int hostByName(const char *name, IPAddress &ip)
   {
 #if defined(FIREBASE_WIFI_IS_AVAILABLE)
     return WiFi.hostByName(name, ip);
+#elif defined(FIREBASE_POSIX_SOCKET)
+    return WiFiClientImpl::hostByName(name, ip);
 #else
     return 1;
 #endif
@@ -583,10 +591,18 @@ public:
       }
     }
 
+    clearReadBuffer();
     _tcp_client->setClient(_basic_client);
     _tcp_client->setDebugLevel(2);
-    if (!_tcp_client->connect(_host.c_str(), _port))
+    if (!connectHost())
+    {
+#if !defined(FIREBASE_DISABLE_DNS_CACHE)
+      // the cached address may be outdated
+      if (_dns_cache)
+        _dns_cache->invalidate(_host.c_str());
+#endif
       return setError(FIREBASE_ERROR_TCP_ERROR_CONNECTION_REFUSED);
+    }
 
 #if defined(FIREBASE_WIFI_IS_AVAILABLE) && (defined(ESP32) || defined(ESP8266) || defined(MB_ARDUINO_PICO))
     if (_client_type == firebase_client_type_internal_basic_client)
@@ -647,6 +663,7 @@ public:
    */
   void stop()
   {
+    clearReadBuffer();
     if (_tcp_client)
       _tcp_client->stop();
   }
@@ -675,6 +692,11 @@ public:
     if (!_tcp_client->connected() && !connect())
       return setError(FIREBASE_ERROR_TCP_ERROR_CONNECTION_REFUSED);
 
+#if defined(BSSL_SSL_CLIENT_HAS_CORK)
+    // The request is sent in full records, the rest is sent when the response is read.
+    _tcp_client->cork();
+#endif
+
     int toSend = _chunkSize;
     int sent = 0;
     while (sent < (int)size)
@@ -765,7 +787,7 @@ public:
     if (!_tcp_client)
       return setError(FIREBASE_ERROR_TCP_CLIENT_NOT_INITIALIZED);
 
-    return _tcp_client->available();
+    return Firebase_Buffered_Client::available();
   }
 
   /**
@@ -777,7 +799,7 @@ public:
     if (!_basic_client)
       return setError(FIREBASE_ERROR_TCP_CLIENT_NOT_INITIALIZED);
 
-    return _tcp_client->read();
+    return Firebase_Buffered_Client::read();
   }
 
   int read(uint8_t *buf, size_t len)
@@ -796,7 +818,7 @@ public:
     if (!_basic_client)
       return setError(FIREBASE_ERROR_TCP_CLIENT_NOT_INITIALIZED);
 
-    return _tcp_client->read(buf, len);
+    return Firebase_Buffered_Client::read(buf, len);
   }
 
   /**
@@ -815,6 +837,7 @@ public:
    */
   void flush()
   {
+    clearReadBuffer();
     if (_tcp_client && _tcp_client->connected())
       _tcp_client->flush();
   }
@@ -832,7 +855,7 @@ public:
   {
     if (!_tcp_client)
       return 0;
-    return _tcp_client->peek();
+    return Firebase_Buffered_Client::peek();
   }
 
   int connect(IPAddress ip, uint16_t port)
@@ -869,6 +892,17 @@ public:
     _mbfs = mbfs;
   }
 
+#if !defined(FIREBASE_DISABLE_DNS_CACHE)
+  /**
+   * Set the DNS cache which is shared by all connections.
+   * @param cache The DNS cache.
+   */
+  void setDNSCache(Firebase_DNS_Cache *cache)
+  {
+    _dns_cache = cache;
+  }
+#endif
+
   void setClockStatus(bool status)
   {
     _clock_ready = status;
@@ -901,6 +935,7 @@ public:
 
   void clear()
   {
+    releaseReadBuffer();
     if (_basic_client && _client_type == firebase_client_type_internal_basic_client)
     {
 #if defined(FIREBASE_WIFI_IS_AVAILABLE)
@@ -1141,6 +1176,47 @@ public:
   firebase_cert_type certType = firebase_cert_type_undefined;
   bool clockReady = false;
 
+protected:
+  /**
+   * Connect to host, the internal basic client is connected to the cached address of host when available.
+   * @return false when the connection failed or the lookup of host failed recently.
+   */
+  bool connectHost()
+  {
+#if !defined(FIREBASE_DISABLE_DNS_CACHE) && defined(BSSL_SSL_CLIENT_HAS_SECURE_PORT_CHECK)
+    if (_dns_cache && _dns_cache->getResolver() && _client_type == firebase_client_type_internal_basic_client &&
+        !_basic_client->connected())
+    {
+      IPAddress ip;
+      if (!_dns_cache->resolve(_host.c_str(), ip))
+        return false;
+
+      // the plain connection dials by itself, it is made to the address
+      if (!_tcp_client->isSecurePort(_port))
+      {
+        if (_tcp_client->connect(ip, _port))
+          return true;
+        _dns_cache->invalidate(_host.c_str());
+      }
+      // the SSL connection is made over the connected basic client,
+      // the basic client resolves the host by itself when the cached address can't be connected
+      else if (!_basic_client->connect(ip, _port))
+        _dns_cache->invalidate(_host.c_str());
+    }
+#endif
+    return _tcp_client->connect(_host.c_str(), _port);
+  }
+
+  int rawAvailable()
+  {
+    return _tcp_client->available();
+  }
+
+  int rawRead(uint8_t *buf, size_t size)
+  {
+    return _tcp_client->read(buf, size);
+  }
+
 private:
   // lwIP TCP Keepalive idle in seconds.
   int _tcpKeepIdleSeconds = -1;
@@ -1183,6 +1259,9 @@ private:
   int *response_code = nullptr;
   FirebaseConfig *_config = nullptr;
   FirebaseAuth *_auth = nullptr;
+#if !defined(FIREBASE_DISABLE_DNS_CACHE)
+  Firebase_DNS_Cache *_dns_cache = nullptr;
+#endif
 
   firebase_cert_type _cert_type = firebase_cert_type_undefined;
   firebase_client_type _client_type = firebase_client_type_undefined;
@@ -259,7 +259,13 @@ int BSSL_SSL_Client::available()
     }
     // flush the buffer if it's stuck in the SENDAPP state
     else if (state & BR_SSL_SENDAPP)
-        br_ssl_engine_flush(_eng, 0);
+    {
+        // the corked data is sent on the first read
+        if (_corked)
+            uncork();
+        else
+            br_ssl_engine_flush(_eng, 0);
+    }
     // other state, or client is closed
     return 0;
 }
@@ -456,6 +462,11 @@ void BSSL_SSL_Client::enableSSL(bool enable)
     _isSSLEnabled = enable;
 }
 
+bool BSSL_SSL_Client::isSecurePort(uint16_t port)
+{
+    return _isSSLEnabled && mIsSecurePort(port);
+}
+
 int BSSL_SSL_Client::connectSSL(IPAddress ip, uint16_t port)
 {
 
@@ -490,6 +501,8 @@ int BSSL_SSL_Client::connectSSL(const char *host, uint16_t port)
 
 void BSSL_SSL_Client::stop()
 {
+    _corked = false;
+
     if (!_secure)
         return;
 
@@ -569,6 +582,35 @@ void BSSL_SSL_Client::setBufferSizes(int recv, int xmit)
     _iobuf_out_size = xmit;
 }
 
+void BSSL_SSL_Client::cork()
+{
+    // Keep the written data in the io buffer, the full buffer is sent as one record
+    // and the rest is sent by uncork() or when the response is read.
+    _corked = true;
+}
+
+void BSSL_SSL_Client::uncork()
+{
+    if (!_corked)
+        return;
+
+    _corked = false;
+
+    if (!mIsClientInitialized(false) || !_secure || !mSoftConnected(__func__))
+        return;
+
+    // commit the written data to the engine
+    unsigned state = mUpdateEngine();
+    if (state & BR_SSL_SENDAPP)
+    {
+        // close the record and send it
+        br_ssl_engine_flush(_eng, 0);
+        mUpdateEngine();
+    }
+
+    _basic_client->flush();
+}
+
 int BSSL_SSL_Client::availableForWrite()
 {
     if (!mIsClientInitialized(false) || !_secure)
@@ -1438,6 +1480,7 @@ int BSSL_SSL_Client::mConnectBasicClient(const char *host, IPAddress ip, uint16_
 
     _secure = false;
     _write_idx = 0;
+    _corked = false;
 #if defined(ESP_SSLCLIENT_ENABLE_DEBUG)
     esp_ssl_debug_print(PSTR("Basic client connected!"), _debug_level, esp_ssl_debug_info, __func__);
 #endif
@@ -1821,7 +1864,9 @@ unsigned BSSL_SSL_Client::mUpdateEngine()
 
             buf = br_ssl_engine_sendrec_buf(_eng, &len);
             wlen = _basic_client->write(buf, len);
-            _basic_client->flush();
+            // the underlying client is flushed once when uncorked
+            if (!_corked)
+                _basic_client->flush();
             if (wlen <= 0)
             {
                 // if the arduino client encountered an error
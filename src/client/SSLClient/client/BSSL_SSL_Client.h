@@ -60,6 +60,12 @@
 
 #define BSSL_SSL_CLIENT_MIN_SESSION_TIMEOUT_SEC 60
 
+// The client supports cork() and uncork()
+#define BSSL_SSL_CLIENT_HAS_CORK
+
+// The client supports isSecurePort()
+#define BSSL_SSL_CLIENT_HAS_SECURE_PORT_CHECK
+
 #if defined(USE_LIB_SSL_ENGINE) || defined(USE_EMBED_SSL_ENGINE)
 
 #include <vector>
@@ -150,6 +156,8 @@ public:
 
     void enableSSL(bool enable);
 
+    bool isSecurePort(uint16_t port);
+
     int connectSSL(IPAddress ip, uint16_t port);
 
     int connectSSL(const char *host, uint16_t port);
@@ -166,6 +174,10 @@ public:
 
     void setBufferSizes(int recv, int xmit);
 
+    void cork();
+
+    void uncork();
+
     operator bool() override { return connected() > 0; }
 
     int availableForWrite() override;
@@ -310,6 +322,10 @@ private:
     //  weird timing issues
     size_t _write_idx = 0;
 
+    // the written data is kept in the io buffer until it is full
+    // or the response is read, see cork()
+    bool _corked = false;
+
     // store the last BearSSL state so we can print changes to the console
     unsigned int _bssl_last_state = 0;
 
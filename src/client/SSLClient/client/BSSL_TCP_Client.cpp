@@ -296,6 +296,21 @@ void BSSL_TCP_Client::flush()
         read();
 }
 
+bool BSSL_TCP_Client::isSecurePort(uint16_t port)
+{
+    return _ssl_client.isSecurePort(port);
+}
+
+void BSSL_TCP_Client::cork()
+{
+    _ssl_client.cork();
+}
+
+void BSSL_TCP_Client::uncork()
+{
+    _ssl_client.uncork();
+}
+
 void BSSL_TCP_Client::setBufferSizes(int recv, int xmit)
 {
     _ssl_client.setBufferSizes(recv, xmit);
@@ -277,6 +277,15 @@ public:
      */
     void enableSSL(bool enable);
 
+    /**
+     * Check whether connect() makes the SSL connection to the port.
+     * The SSL connection is made over the basic client that was already connected,
+     * the plain connection connects the basic client by itself.
+     * @param port The server port.
+     * @return true when SSL is enabled and the port is the secure port.
+     */
+    bool isSecurePort(uint16_t port);
+
     /**
      * Upgrade the current connection by setting up the SSL and perform the SSL handshake.
      *
@@ -342,6 +351,18 @@ public:
      */
     void setBufferSizes(int recv, int xmit);
 
+    /**
+     * Keep the written data in the SSL transmit buffer until it is full.
+     * The data is sent in full records and the rest is sent when uncork() was called
+     * or when the response was read.
+     */
+    void cork();
+
+    /**
+     * Send the data that was kept by cork().
+     */
+    void uncork();
+
     operator bool() override { return connected(); }
 
     int availableForWrite() override;
@@ -6,6 +6,8 @@
  * The WiFiClient in ESP32 cannot be used in multithreading environment as in FreeRTOS task
  * which can (always) lead to the assetion error "pbuf_free: p->ref > 0".
  *
+ * On POSIX host (FIREBASE_POSIX_SOCKET), it is the socket client that can be used as the external generic client.
+ *
  * Created August 20, 2023
  *
  * The MIT License (MIT)
@@ -30,10 +32,47 @@
  * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
-#if !defined(WIFICLIENT_IMPL_H) && defined(ESP32)
+#include "../FB_Network.h"
+
+#if !defined(WIFICLIENT_IMPL_H) && (defined(ESP32) || defined(FIREBASE_POSIX_SOCKET))
 #define WIFICLIENT_IMPL_H
 
+#if defined(FIREBASE_POSIX_SOCKET)
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <Client.h>
+
+#define lwip_socket ::socket
+#define lwip_connect ::connect
+#define lwip_setsockopt ::setsockopt
+#define lwip_close ::close
+#define lwip_write ::write
+
+#if !defined(log_e)
+#define log_e(...)
+#define log_i(...)
+#define log_v(...)
+#endif
+#else
 #include <lwip/sockets.h>
+#endif
+
+// Do not raise SIGPIPE when the peer was closed.
+#if defined(MSG_NOSIGNAL)
+#define WIFICLIENT_IMPL_SEND_FLAGS (MSG_DONTWAIT | MSG_NOSIGNAL)
+#else
+#define WIFICLIENT_IMPL_SEND_FLAGS MSG_DONTWAIT
+#endif
+
 class WiFiClientImpl : public Client
 {
 public:
@@ -47,6 +86,9 @@ public:
 #if defined(WIFI_HAS_HOST_BY_NAME)
         if (!WiFiGenericClass::hostByName(host, address))
             return -1;
+#elif defined(FIREBASE_POSIX_SOCKET)
+        if (!hostByName(host, address))
+            return -1;
 #endif
         return tcpConnect(address, port, _timeout);
     }
@@ -97,9 +139,14 @@ public:
     int peek() { return tcpPeek(); }
     void flush()
     {
+#if defined(FIREBASE_POSIX_SOCKET)
+        // The socket sends without the output buffer, the received data is kept as the SSL client
+        // flushes after each record write and the server records can be already received.
+#else
         if (r_available())
             fillRxBuffer();
         _fillPos = _fillSize;
+#endif
     }
 
     void stop() { tcpClose(); }
@@ -126,6 +173,30 @@ public:
 
     virtual int fd() const { return _socket; }
 
+#if defined(FIREBASE_POSIX_SOCKET)
+    /**
+     * Resolve the host name to IPv4 address.
+     * @param host The host name.
+     * @param ip The ip address result.
+     * @return 1 for success or 0 for failed.
+     */
+    static int hostByName(const char *host, IPAddress &ip)
+    {
+        struct addrinfo hints;
+        struct addrinfo *res = nullptr;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+
+        if (getaddrinfo(host, nullptr, &hints, &res) != 0 || !res)
+            return 0;
+
+        ip = IPAddress((uint32_t)((struct sockaddr_in *)res->ai_addr)->sin_addr.s_addr);
+        freeaddrinfo(res);
+        return 1;
+    }
+#endif
+
     int setSocketOption(int option, char *value, size_t len)
     {
         return setSocketOption(SOL_SOCKET, option, (const void *)value, len);
@@ -264,7 +335,9 @@ private:
             return 0;
         }
         int count;
-#ifdef ESP_IDF_VERSION_MAJOR
+#if defined(FIREBASE_POSIX_SOCKET)
+        int res = ::ioctl(_socket, FIONREAD, &count);
+#elif defined(ESP_IDF_VERSION_MAJOR)
         int res = lwip_ioctl(_socket, FIONREAD, &count);
 #else
         int res = lwip_ioctl_r(_socket, FIONREAD, &count);
@@ -333,6 +406,15 @@ private:
         if (timeout <= 0)
             timeout = 30000; // Milli seconds.
 
+#if defined(SO_NOSIGPIPE)
+        lwip_setsockopt(_socket, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+#endif
+
+#if defined(FIREBASE_POSIX_SOCKET)
+        // connect without blocking, the connection is waited with timeout below
+        fcntl(_socket, F_SETFL, fcntl(_socket, F_GETFL, 0) | O_NONBLOCK);
+#endif
+
         fd_set fdset;
         struct timeval tv;
         FD_ZERO(&fdset);
@@ -388,8 +470,9 @@ private:
 
         lwip_setsockopt(_socket, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
         lwip_setsockopt(_socket, SOL_SOCKET, SO_KEEPALIVE, &enable, sizeof(enable));
-
+#if !defined(FIREBASE_POSIX_SOCKET)
         fcntl(_socket, F_SETFL, fcntl(_socket, F_GETFL, 0) | O_NONBLOCK);
+#endif
 
         _connected = true;
 
@@ -447,7 +530,7 @@ private:
 
             if (FD_ISSET(socketFileDescriptor, &set))
             {
-                res = send(socketFileDescriptor, (void *)buf, bytesRemaining, MSG_DONTWAIT);
+                res = send(socketFileDescriptor, (void *)buf, bytesRemaining, WIFICLIENT_IMPL_SEND_FLAGS);
                 if (res > 0)
                 {
                     totalBytesSent += res;
@@ -494,7 +577,7 @@ private:
             return _failed ? -1 : 0;
         }
 
-        int remain = _fillSize - _fillPos;
+        size_t remain = _fillSize - _fillPos;
         if (len <= remain || ((len - remain) <= (_rxBuffSize - _fillSize) && fillRxBuffer() >= (len - remain)))
         {
             if (len == 1)
@@ -534,7 +617,26 @@ private:
 
     int tcpConnected()
     {
+#if defined(FIREBASE_POSIX_SOCKET)
+        if (_socket < 0)
+            return 0;
+
+        // the peer was closed when there is no more data to read
+        if (_fillPos == _fillSize && !r_available())
+        {
+            uint8_t dummy;
+            int res = recv(_socket, &dummy, 1, MSG_DONTWAIT | MSG_PEEK);
+            if (res == 0 || (res < 0 && errno != EWOULDBLOCK && errno != EAGAIN))
+            {
+                tcpClose();
+                return 0;
+            }
+        }
+
+        return 1;
+#else
         return _socket >= 0;
+#endif
     }
 
     bool allocRxBuffer(size_t size)
@@ -33,9 +33,20 @@
 #include "./mbfs/MB_MCU.h"
 #include "FirebaseCore.h"
 
+#if !defined(FIREBASE_DISABLE_DNS_CACHE)
+static FIREBASE_DNS_CACHE_ATTR firebase_dns_cache_entry_t dns_cache_entries[FIREBASE_DNS_CACHE_SIZE];
+
+FirebaseCore::FirebaseCore() : dnsCache(dns_cache_entries)
+{
+#if defined(FIREBASE_WIFI_IS_AVAILABLE)
+    dnsCache.setResolver(Firebase_TCP_Client::hostByName);
+#endif
+}
+#else
 FirebaseCore::FirebaseCore()
 {
 }
+#endif
 
 FirebaseCore::~FirebaseCore()
 {
@@ -1098,6 +1109,9 @@ bool FirebaseCore::handleTokenResponse(int &httpCode)
             {
                 memset(pChunk, 0, tcpHandler.chunkBufSize + 1);
 
+                if (tcpHandler.pChunkIdx == 1)
+                    hh.reservePayload(payload, response);
+
                 // Read the avilable data
                 // chunk transfer encoding?
                 if (response.isChunkedEnc)
@@ -1133,6 +1147,13 @@ bool FirebaseCore::handleTokenResponse(int &httpCode)
     if (tcpClient->connected())
         tcpClient->stop();
 
+    // the truncated payload is not parsed
+    if (tcpHandler.bufferAvailable == FIREBASE_RESPONSE_BODY_ERROR)
+    {
+        response.httpCode = tcpHandler.error.code;
+        payload.clear();
+    }
+
     httpCode = response.httpCode;
 
     if (jsonPtr && payload.length() > 0 && !response.noContent)
@@ -1268,8 +1289,7 @@ bool FirebaseCore::createJWT()
 
             if (auth->token.claims.length() > 2)
             {
-                FirebaseJson claims(auth->token.claims.c_str());
-                jsonPtr->add(pgm2Str(firebase_auth_pgm_str_22 /* "claims" */), claims);
+                jsonPtr->add(pgm2Str(firebase_auth_pgm_str_22 /* "claims" */), FirebaseJson(auth->token.claims.c_str()));
             }
         }
 
@@ -1778,6 +1798,9 @@ bool FirebaseCore::initClient(PGM_P subDomain, firebase_auth_token_status status
 
     FBUtils::idle();
     tcpClient->setSession(&bsslSession);
+#if !defined(FIREBASE_DISABLE_DNS_CACHE)
+    tcpClient->setDNSCache(&dnsCache);
+#endif
     tcpClient->begin(host.c_str(), 443, &response_code);
 
     return true;
@@ -2121,6 +2144,12 @@ void FirebaseCore::errorToString(int httpCode, MB_String &buff)
     case FIREBASE_ERROR_TCP_RESPONSE_READ_FAILED:
         buff += firebase_client_err_pgm_str_7; // "response read failed."
         return;
+    case FIREBASE_ERROR_TCP_RESPONSE_CHUNKED_DATA_INVALID:
+        buff += firebase_client_err_pgm_str_14; // "invalid chunked transfer encoding of response"
+        return;
+    case FIREBASE_ERROR_TCP_RESPONSE_PAYLOAD_DECODE_FAILED:
+        buff += firebase_client_err_pgm_str_15; // "response payload decode failed"
+        return;
     case FIREBASE_ERROR_EXTERNAL_CLIENT_DISABLED:
         buff += firebase_client_err_pgm_str_12; // "custom Client is not yet enabled"
         return;
@@ -2408,6 +2437,6 @@ bool FirebaseCore::waitIdle(int &httpCode)
     return true;
 }
 
-FirebaseCore Core = FirebaseCore();
+FirebaseCore Core;
 
 #endif
\ No newline at end of file
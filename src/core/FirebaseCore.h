@@ -72,7 +72,6 @@ private:
     JsonHelper jh;
     HttpHelper hh;
     Base64Helper bh;
-    OtaHelper oh;
     uint32_t baseTs = 0;
     uint32_t tsOffset = 0;
     struct firebase_cfg_int_t internal;
@@ -87,6 +86,9 @@ private:
     struct token_info_t tokenInfo;
     bool authenticated = false;
     Firebase_TCP_Client *tcpClient = nullptr;
+#if !defined(FIREBASE_DISABLE_DNS_CACHE)
+    Firebase_DNS_Cache dnsCache;
+#endif
     FirebaseJson *jsonPtr = nullptr;
     FirebaseJsonData *resultPtr = nullptr;
     int response_code = 0;
@@ -27,6 +27,7 @@
 #undef ENABLE_ERROR_STRING
 #undef ENABLE_OTA_FIRMWARE_UPDATE
 #undef USE_CONNECTION_KEEP_ALIVE_MODE
+#undef FIREBASE_ENABLE_GZIP_RESPONSE
 
 #undef FB_DEFAULT_DEBUG_PORT
 #undef FIREBASE_DEFAULT_DEBUG_PORT
@@ -680,42 +680,34 @@ bool FB_Firestore::firestore_sendRequest(FirebaseData *fbdo, struct firebase_fir
         Core.hh.addContentLengthHeader(header, req->payload.length());
     }
 
-    Core.hh.addGAPIsHostHeader(header, firebase_cfs_pgm_str_55 /* "firestore." */);
+    Core.hh.addGAPIsHostHeaderFields(&Core.sh, header, fbdo->session.header_template,
+                                     firebase_cfs_pgm_str_55 /* "firestore." */, Core.config->signer.customHeaders);
 
     if (!Core.config->signer.test_mode)
-    {
-
-        Core.hh.addAuthHeaderFirst(header, Core.getTokenType());
-        fbdo->tcpClient.send(header.c_str());
-        header.clear();
-
-        if (fbdo->session.response.code < 0)
-            return false;
+        Core.hh.addAuthHeader(header, Core.getTokenType(), Core.getToken());
 
-        fbdo->tcpClient.send(Core.getToken());
-
-        if (fbdo->session.response.code < 0)
-            return false;
-
-        Core.hh.addNewLine(header);
-    }
-
-    Core.hh.addUAHeader(header);
     bool keepAlive = false;
 #if defined(USE_CONNECTION_KEEP_ALIVE_MODE)
     keepAlive = true;
 #endif
     Core.hh.addConnectionHeader(header, keepAlive);
-    Core.hh.getCustomHeaders(&Core.sh,header, Core.config->signer.customHeaders);
+    Core.hh.addAcceptEncodingHeader(header);
     Core.hh.addNewLine(header);
+
+    bool hasPayload = req->payload.length() > 0 && (method == http_post || method == http_patch);
+
+    // the header and the small payload are sent in one write
+    bool payloadSent = hasPayload && !req->uploadCallback && req->payload.length() <= FIREBASE_COALESCE_PAYLOAD_SIZE;
+    if (payloadSent)
+        header += req->payload;
+
     fbdo->session.response.code = FIREBASE_ERROR_TCP_ERROR_NOT_CONNECTED;
     fbdo->tcpClient.send(header.c_str());
 
     if (fbdo->session.response.code < 0)
         return false;
 
-    if (fbdo->session.response.code > 0 && req->payload.length() > 0 &&
-        (method == http_post || method == http_patch))
+    if (fbdo->session.response.code > 0 && hasPayload && !payloadSent)
     {
         if (req->uploadCallback)
         {
@@ -792,40 +784,19 @@ bool FB_Firestore::handleResponse(FirebaseData *fbdo, struct firebase_firestore_
     if (!fbdo->waitResponse(tcpHandler))
         return false;
 
-    bool complete = false;
-
-    while (tcpHandler.available() > 0 /* data available to read payload */ ||
-           tcpHandler.payloadRead < response.contentLen /* incomplete content read  */ || !complete)
+    // Waring when large payload response may require the time for complete reading
+    if (req->uploadCallback && millis() - req->requestTime > 10000 &&
+        fbdo->session.cfs.cbUploadInfo.status != firebase_cfs_upload_status_process_response)
     {
-        tcpHandler.dataTime = millis();
-
-        // Waring when large payload response may require the time for complete reading
-        if (req->uploadCallback && millis() - req->requestTime > 10000 &&
-            fbdo->session.cfs.cbUploadInfo.status != firebase_cfs_upload_status_process_response)
-        {
-            req->requestTime = millis();
-            fbdo->session.cfs.cbUploadInfo.status = firebase_cfs_upload_status_process_response;
-            CFS_UploadStatusInfo in;
-            in.status = firebase_cfs_upload_status_process_response;
-            in.progress = 100;
-            sendUploadCallback(fbdo, in, req->uploadCallback, req->uploadStatusInfo);
-        }
-
-        if (!fbdo->readResponse(&fbdo->session.cfs.payload, tcpHandler, response) && !response.isChunkedEnc)
-        {
-            complete = true;
-            break;
-        }
-
-        // Last chunk?
-        if (Core.ut.isChunkComplete(&tcpHandler, &response, complete))
-            break;
+        req->requestTime = millis();
+        fbdo->session.cfs.cbUploadInfo.status = firebase_cfs_upload_status_process_response;
+        CFS_UploadStatusInfo in;
+        in.status = firebase_cfs_upload_status_process_response;
+        in.progress = 100;
+        sendUploadCallback(fbdo, in, req->uploadCallback, req->uploadStatusInfo);
     }
 
-    // To make sure all chunks read and
-    // ready to send next request
-    if (response.isChunkedEnc)
-        fbdo->tcpClient.flush();
+    fbdo->readResponseBody(&fbdo->session.cfs.payload, tcpHandler, response);
 
     // parse the payload for error
     fbdo->getError(fbdo->session.cfs.payload, tcpHandler, response, false);
@@ -605,43 +605,46 @@ bool FB_Functions::functions_sendRequest(FirebaseData *fbdo, struct firebase_fun
         Core.hh.addContentLengthHeader(header, len);
         header += firebase_func_pgm_str_37; // "x-goog-content-length-range: 0,104857600"
         Core.hh.addNewLine(header);
-        Core.hh.addHostHeader(header, req->host.c_str());
+        Core.hh.addHostHeaderFields(&Core.sh, header, fbdo->session.header_template,
+                                    req->host.c_str(), Core.config->signer.customHeaders);
     }
     else
     {
 
         if (req->requestType == firebase_functions_request_type_upload_bucket_sources)
-            Core.hh.addHostHeader(header, req->host.c_str());
+            Core.hh.addHostHeaderFields(&Core.sh, header, fbdo->session.header_template,
+                                        req->host.c_str(), Core.config->signer.customHeaders);
         else
-            Core.hh.addGAPIsHostHeader(header, firebase_func_pgm_str_38 /* "cloudfunctions." */);
+            Core.hh.addGAPIsHostHeaderFields(&Core.sh, header, fbdo->session.header_template,
+                                             firebase_func_pgm_str_38 /* "cloudfunctions." */, Core.config->signer.customHeaders);
 
         if (req->requestType != firebase_functions_request_type_upload_bucket_sources)
         {
             if (!Core.config->signer.test_mode)
-            {
-                Core.hh.addAuthHeaderFirst(header, Core.getTokenType());
-                header += Core.getToken();
-                Core.hh.addNewLine(header);
-            }
+                Core.hh.addAuthHeader(header, Core.getTokenType(), Core.getToken());
         }
     }
 
-    Core.hh.addUAHeader(header);
     bool keepAlive = false;
 #if defined(USE_CONNECTION_KEEP_ALIVE_MODE)
     keepAlive = true;
 #endif
     Core.hh.addConnectionHeader(header, keepAlive);
-    Core.hh.getCustomHeaders(&Core.sh,header, Core.config->signer.customHeaders);
+    Core.hh.addAcceptEncodingHeader(header);
     Core.hh.addNewLine(header);
 
+    // the header and the small payload are sent in one write
+    bool payloadSent = req->payload.length() > 0 && req->payload.length() <= FIREBASE_COALESCE_PAYLOAD_SIZE;
+    if (payloadSent)
+        header += req->payload;
+
     fbdo->session.response.code = FIREBASE_ERROR_TCP_ERROR_NOT_CONNECTED;
 
     fbdo->tcpSend(header.c_str());
     if (fbdo->session.response.code < 0)
         return false;
 
-    if (fbdo->session.response.code > 0 && req->payload.length() > 0)
+    if (fbdo->session.response.code > 0 && req->payload.length() > 0 && !payloadSent)
         fbdo->tcpSend(req->payload.c_str());
 
     header.clear();
@@ -762,23 +765,7 @@ bool FB_Functions::handleResponse(FirebaseData *fbdo)
     if (!fbdo->waitResponse(tcpHandler))
         return false;
 
-    bool complete = false;
-
-    while (tcpHandler.available() > 0 /* data available to read payload */ ||
-           tcpHandler.payloadRead < response.contentLen /* incomplete content read  */)
-    {
-        if (!fbdo->readResponse(&fbdo->session.cfn.payload, tcpHandler, response) && !response.isChunkedEnc)
-            break;
-
-        // Last chunk?
-        if (Core.ut.isChunkComplete(&tcpHandler, &response, complete))
-            break;
-    }
-
-    // To make sure all chunks read and
-    // ready to send next request
-    if (response.isChunkedEnc)
-        fbdo->tcpClient.flush();
+    fbdo->readResponseBody(&fbdo->session.cfn.payload, tcpHandler, response);
 
     // parse the payload
     if (fbdo->session.cfn.payload.length() > 0 &&
@@ -492,28 +492,15 @@ bool GG_CloudStorage::gcs_sendRequest(FirebaseData *fbdo, struct firebase_gcs_re
 
     if (req->requestType != firebase_gcs_request_type_upload_resumable_run)
     {
-        Core.hh.addGAPIsHostHeader(header, firebase_pgm_str_61 /* "www" */);
+        Core.hh.addGAPIsHostHeaderFields(&Core.sh, header, fbdo->session.header_template,
+                                         firebase_pgm_str_61 /* "www" */, MB_String());
 
         if (!Core.config->signer.test_mode)
-        {
-            Core.hh.addAuthHeaderFirst(header, Core.getTokenType());
-
-            fbdo->tcpSend(header.c_str());
-            header.clear();
-
-            if (fbdo->session.response.code < 0)
-                return false;
-
-            fbdo->tcpSend(Core.getToken());
-
-            if (fbdo->session.response.code < 0)
-                return false;
-
-            Core.hh.addNewLine(header);
-        }
+            Core.hh.addAuthHeader(header, Core.getTokenType(), Core.getToken());
     }
+    else
+        Core.hh.addUAHeader(header);
 
-    Core.hh.addUAHeader(header);
     // required for ESP32 core sdk v2.0.x.
 
     bool keepAlive = false;
@@ -522,6 +509,10 @@ bool GG_CloudStorage::gcs_sendRequest(FirebaseData *fbdo, struct firebase_gcs_re
 #endif
     Core.hh.addConnectionHeader(header, keepAlive);
 
+    // the downloaded file is written as it was received
+    if (req->requestType != firebase_gcs_request_type_download && req->requestType != firebase_gcs_request_type_download_ota)
+        Core.hh.addAcceptEncodingHeader(header);
+
     if (req->requestType == firebase_gcs_request_type_upload_simple)
     {
         Core.hh.addContentTypeHeader(header, req->mime.c_str());
@@ -632,12 +623,18 @@ bool GG_CloudStorage::gcs_sendRequest(FirebaseData *fbdo, struct firebase_gcs_re
     }
     else
     {
+        // the header and the small metadata are sent in one write
+        bool payloadSent = req->requestType == firebase_gcs_request_type_upload_resumable_init && fbdo->session.jsonPtr &&
+                           strlen(fbdo->session.jsonPtr->raw()) <= FIREBASE_COALESCE_PAYLOAD_SIZE;
+        if (payloadSent)
+            header += fbdo->session.jsonPtr->raw();
+
         fbdo->tcpSend(header.c_str());
         header.clear();
         if (fbdo->session.response.code < 0)
             return false;
 
-        if (req->requestType == firebase_gcs_request_type_upload_resumable_init)
+        if (req->requestType == firebase_gcs_request_type_upload_resumable_init && !payloadSent)
         {
             if (fbdo->session.jsonPtr)
                 fbdo->tcpSend(fbdo->session.jsonPtr->raw());
@@ -1208,8 +1205,7 @@ bool GG_CloudStorage::handleResponse(FirebaseData *fbdo, struct firebase_gcs_req
 
             if (response.httpCode == FIREBASE_ERROR_HTTP_CODE_PERMANENT_REDIRECT) // resume incomplete
             {
-                int p1 = 0;
-                if (Core.sh.find(tcpHandler.header, firebase_gcs_pgm_str_48 /* "Range: bytes=0-" */, false, 0, p1))
+                if (response.chunkRange > -1)
                 {
                     if (_resumableUploadTasks.size() > 0)
                     {
@@ -1217,9 +1213,7 @@ bool GG_CloudStorage::handleResponse(FirebaseData *fbdo, struct firebase_gcs_req
                         fbdo->createResumableTask(ruTask, req->fileSize, req->location,
                                                   req->localFileName, req->remoteFileName, req->storageType,
                                                   firebase_gcs_request_type_upload_resumable_run);
-                        ruTask.req.chunkRange = atoi(tcpHandler.header.substr(p1 + strlen_P(firebase_gcs_pgm_str_48 /* "Range: bytes=0-" */),
-                                                                              tcpHandler.header.length() - p1 - strlen_P(firebase_gcs_pgm_str_48 /* "Range: bytes=0-" */))
-                                                         .c_str());
+                        ruTask.req.chunkRange = response.chunkRange;
                         ruTask.req.uploadCallback = req->uploadCallback;
                         ruTask.req.uploadStatusInfo = req->uploadStatusInfo;
                         _resumableUploadTasks.push_back(ruTask);
@@ -1274,21 +1268,18 @@ bool GG_CloudStorage::handleResponse(FirebaseData *fbdo, struct firebase_gcs_req
 
                 if (bufLen > 1024 * 16)
                     bufLen = 1024 * 16;
-                uint8_t *buf = reinterpret_cast<uint8_t *>(Core.mbfs.newP(bufLen, false));
                 int stage = 0;
 
                 if (isOTA)
                     fbdo->prepareDownloadOTA(tcpHandler, response);
 
-                while (fbdo->processDownload(req->localFileName, req->storageType, buf, bufLen, tcpHandler,
+                while (fbdo->processDownload(req->localFileName, req->storageType, bufLen, tcpHandler,
                                              response, stage, isOTA))
                 {
                     if (stage)
                         reportDownloadProgress(fbdo, req, tcpHandler.payloadRead);
                 }
 
-                Core.mbfs.delP(&buf);
-
                 reportDownloadProgress(fbdo, req, tcpHandler.payloadRead);
 
                 if (isOTA)
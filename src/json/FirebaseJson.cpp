@@ -54,15 +54,51 @@ FirebaseJsonBase::~FirebaseJsonBase()
 FirebaseJsonBase &FirebaseJsonBase::mClear()
 {
     mIteratorEnd();
-    if (root != NULL)
-        MB_JSON_Delete(root);
-    root = NULL;
+    releaseRoot();
     buf.clear();
     errorPos = -1;
     return *this;
 }
+
+void FirebaseJsonBase::releaseRoot()
+{
+    // the shared root is deleted by its last owner
+    if (shared && --(*shared) > 0)
+        root = NULL;
+    else
+    {
+        if (shared)
+            delete shared;
+        if (root != NULL)
+            MB_JSON_Delete(root);
+    }
+    root = NULL;
+    shared = NULL;
+    insitu_buf.clear();
+}
+
+void FirebaseJsonBase::ownRoot()
+{
+    // copy-on-write, take the private copy of the shared root before modifying it
+    if (!shared)
+        return;
+
+    if (*shared > 1)
+    {
+        (*shared)--;
+        root = MB_JSON_Duplicate(root, true);
+    }
+    else
+        delete shared;
+
+    shared = NULL;
+}
+
 void FirebaseJsonBase::mCopy(FirebaseJsonBase &other)
 {
+    if (this == &other)
+        return;
+
     mClear();
     this->root = MB_JSON_Duplicate(other.root, true);
     this->doubleDigits = other.doubleDigits;
@@ -74,7 +110,78 @@ void FirebaseJsonBase::mCopy(FirebaseJsonBase &other)
     this->buf = other.buf;
 }
 
-bool FirebaseJsonBase::setRaw(const char *raw)
+void FirebaseJsonBase::mShare(FirebaseJsonBase &other)
+{
+    if (this == &other || (shared && shared == other.shared))
+        return;
+
+    // the elements parsed in-situ point into the other's buffer, they can't be shared
+    if (other.root == NULL || other.insitu_buf.length() > 0)
+    {
+        mCopy(other);
+        return;
+    }
+
+    mClear();
+
+    if (!other.shared)
+    {
+        other.shared = new int;
+        *other.shared = 1;
+    }
+
+    (*other.shared)++;
+    this->shared = other.shared;
+    this->root = other.root;
+    this->doubleDigits = other.doubleDigits;
+    this->floatDigits = other.floatDigits;
+    this->httpCode = other.httpCode;
+    this->serData = other.serData;
+    this->root_type = other.root_type;
+    this->iterator_data = other.iterator_data;
+    this->buf = other.buf;
+}
+
+void FirebaseJsonBase::mMove(FirebaseJsonBase &other)
+{
+    if (this == &other)
+        return;
+
+    mClear();
+
+    this->root = other.root;
+    this->shared = other.shared;
+    this->doubleDigits = other.doubleDigits;
+    this->floatDigits = other.floatDigits;
+    this->httpCode = other.httpCode;
+    this->errorPos = other.errorPos;
+    this->serData = other.serData;
+    this->root_type = other.root_type;
+    this->insitu_buf.swap(other.insitu_buf);
+    this->buf.swap(other.buf);
+
+    other.root = NULL;
+    other.shared = NULL;
+    other.mClear();
+}
+
+MB_JSON *FirebaseJsonBase::takeRoot()
+{
+    MB_JSON *e = NULL;
+
+    if ((shared && *shared > 1) || insitu_buf.length() > 0)
+        e = MB_JSON_Duplicate(root, true);
+    else
+    {
+        e = root;
+        root = NULL;
+    }
+
+    mClear();
+    return e;
+}
+
+bool FirebaseJsonBase::setRaw(const char *raw, bool insitu)
 {
     mClear();
 
@@ -89,7 +196,16 @@ bool FirebaseJsonBase::setRaw(const char *raw)
         if (raw[i] == '{' || raw[i] == '[')
         {
             this->root_type = (raw[i] == '{') ? Root_Type_JSON : Root_Type_JSONArray;
-            root = parse(raw);
+            if (insitu)
+            {
+                // the tree points into the text, keep it off the short string buffer that moves with the object
+                size_t len = strlen(raw);
+                insitu_buf.reserve(len > MB_STRING_SSO_SIZE ? len : MB_STRING_SSO_SIZE);
+                insitu_buf = raw;
+                root = parseInSitu(insitu_buf);
+            }
+            else
+                root = parse(raw);
         }
         else
         {
@@ -101,6 +217,36 @@ bool FirebaseJsonBase::setRaw(const char *raw)
     return root != NULL;
 }
 
+bool FirebaseJsonBase::setRawInSitu(MB_String &raw)
+{
+    size_t i = 0;
+    while (i < raw.length() && raw[i] == ' ')
+        i++;
+
+    if (i == raw.length() || (raw[i] != '{' && raw[i] != '['))
+    {
+        bool ret = setRaw(raw.c_str());
+        raw.clear();
+        return ret;
+    }
+
+    mClear();
+    this->root_type = (raw[i] == '{') ? Root_Type_JSON : Root_Type_JSONArray;
+
+    // the heap buffer is taken as is, the short string is copied off its inline buffer
+    if (raw.length() >= MB_STRING_SSO_SIZE)
+        insitu_buf.swap(raw);
+    else
+    {
+        insitu_buf.reserve(MB_STRING_SSO_SIZE);
+        insitu_buf = raw;
+    }
+    raw.clear();
+
+    root = parseInSitu(insitu_buf);
+    return root != NULL;
+}
+
 MB_JSON *FirebaseJsonBase::parse(const char *raw)
 {
     const char *s = NULL;
@@ -109,6 +255,18 @@ MB_JSON *FirebaseJsonBase::parse(const char *raw)
     return e;
 }
 
+MB_JSON *FirebaseJsonBase::parseInSitu(MB_String &raw)
+{
+    const char *s = NULL;
+    size_t len = raw.length();
+    char *p = (char *)raw.c_str();
+    MB_JSON *e = MB_JSON_ParseInSitu(p, len + 1, &s, 1);
+    errorPos = (s - p != (int)len) ? s - p : -1;
+    if (!e)
+        raw.clear();
+    return e;
+}
+
 void FirebaseJsonBase::prepareRoot()
 {
     if (root == NULL)
@@ -449,7 +607,7 @@ void FirebaseJsonBase::mCollectIterator(MB_JSON *e, int type, int &arrIndex)
         {
             result.ofs1 = pos;
             result.len1 = strlen(e->string);
-            iterator_data.buf_offset = (e->type != MB_JSON_Object && e->type != MB_JSON_Array) ? pos + result.len1 : pos;
+            iterator_data.buf_offset = ((e->type & 0xff) != MB_JSON_Object && (e->type & 0xff) != MB_JSON_Array) ? pos + result.len1 : pos;
         }
     }
 
@@ -466,7 +624,7 @@ void FirebaseJsonBase::mCollectIterator(MB_JSON *e, int type, int &arrIndex)
             result.ofs2 = pos - result.ofs1 - result.len1;
             result.len2 = strlen(p);
             MB_JSON_free(p);
-            iterator_data.buf_offset = (e->type != MB_JSON_Object && e->type != MB_JSON_Array) ? pos + result.len2 : pos;
+            iterator_data.buf_offset = ((e->type & 0xff) != MB_JSON_Object && (e->type & 0xff) != MB_JSON_Array) ? pos + result.len2 : pos;
         }
     }
     result.type = type;
@@ -534,12 +692,10 @@ void FirebaseJsonBase::toBuf(fb_json_serialize_mode mode)
 {
     if (root != NULL)
     {
-        char *out = mode == fb_json_serialize_mode_pretty ? MB_JSON_Print(root) : MB_JSON_PrintUnformatted(root);
-        if (out)
-        {
-            buf = out;
-            MB_JSON_free(out);
-        }
+        bool prettify = mode == fb_json_serialize_mode_pretty;
+        buf.clear();
+        buf.reserve(MB_JSON_SerializedBufferLength(root, prettify));
+        MB_JSON_PrintToWriter(root, prettify, FIREBASE_JSON_PRINT_CHUNK_SIZE, stringWriter, &buf);
     }
 }
 
@@ -549,8 +705,7 @@ bool FirebaseJsonBase::mReadClient(Client *client)
     buf.clear();
     if (readClient(client, buf))
     {
-        if (root != NULL)
-            MB_JSON_Delete(root);
+        releaseRoot();
         root = parse(buf.c_str());
         buf.clear();
         return root != NULL;
@@ -563,8 +718,7 @@ bool FirebaseJsonBase::mReadStream(Stream *s, int timeoutMS)
     // non-blocking read
     if (readStream(s, serData, buf, true, timeoutMS))
     {
-        if (root != NULL)
-            MB_JSON_Delete(root);
+        releaseRoot();
         root = parse(buf.c_str());
         buf.clear();
         return root != NULL;
@@ -578,8 +732,7 @@ bool FirebaseJsonBase::mReadSdFat(SD_FAT_FILE &file, int timeoutMS)
     // non-blocking read
     if (readSdFatFile(file, serData, buf, true, timeoutMS))
     {
-        if (root != NULL)
-            MB_JSON_Delete(root);
+        releaseRoot();
         root = parse(buf.c_str());
         buf.clear();
         return root != NULL;
@@ -588,6 +741,495 @@ bool FirebaseJsonBase::mReadSdFat(SD_FAT_FILE &file, int timeoutMS)
 }
 #endif
 
+bool FirebaseJsonBase::mToCBOR(Print *print, MB_VECTOR<uint8_t> *vec)
+{
+    if (!root)
+        return false;
+
+    struct cbor_writer_t w;
+    w.print = print;
+    w.vec = vec;
+
+    if (root_type == Root_Type_Raw)
+    {
+        // encode the value that raw literal represents
+        MB_JSON *e = MB_JSON_Parse(root->valuestring);
+        if (!e)
+            return false;
+        cborWriteItem(w, e);
+        MB_JSON_Delete(e);
+    }
+    else
+        cborWriteItem(w, root);
+
+    return !w.error;
+}
+
+void FirebaseJsonBase::cborWrite(cbor_writer_t &w, const uint8_t *data, size_t len)
+{
+    if (w.error || len == 0)
+        return;
+
+    if (w.print)
+        w.error = w.print->write(data, len) != len;
+    else if (w.vec)
+    {
+        for (size_t i = 0; i < len; i++)
+        {
+            uint8_t b = data[i];
+            w.vec->push_back(b);
+        }
+    }
+}
+
+void FirebaseJsonBase::cborWriteHead(cbor_writer_t &w, uint8_t major, uint64_t val)
+{
+    uint8_t head[9];
+    uint8_t n = 0;
+
+    if (val < 24)
+        head[0] = (major << 5) | (uint8_t)val;
+    else if (val <= 0xff)
+    {
+        head[0] = (major << 5) | 24;
+        n = 1;
+    }
+    else if (val <= 0xffff)
+    {
+        head[0] = (major << 5) | 25;
+        n = 2;
+    }
+    else if (val <= 0xffffffffULL)
+    {
+        head[0] = (major << 5) | 26;
+        n = 4;
+    }
+    else
+    {
+        head[0] = (major << 5) | 27;
+        n = 8;
+    }
+
+    // big endian argument
+    for (uint8_t i = 0; i < n; i++)
+        head[n - i] = (uint8_t)(val >> (8 * i));
+
+    cborWrite(w, head, n + 1);
+}
+
+void FirebaseJsonBase::cborWriteItem(cbor_writer_t &w, MB_JSON *e)
+{
+    int type = e->type & 0xff;
+
+    if (type == MB_JSON_Object || type == MB_JSON_Array)
+    {
+        cborWriteHead(w, type == MB_JSON_Object ? 5 : 4, MB_JSON_GetArraySize(e));
+        MB_JSON *item = e->child;
+        while (item && !w.error)
+        {
+            if (type == MB_JSON_Object)
+            {
+                size_t len = strlen(item->string);
+                cborWriteHead(w, 3, len);
+                cborWrite(w, (const uint8_t *)item->string, len);
+            }
+            cborWriteItem(w, item);
+            item = item->next;
+        }
+    }
+    else if (type == MB_JSON_String)
+    {
+        size_t len = strlen(e->valuestring);
+        cborWriteHead(w, 3, len);
+        cborWrite(w, (const uint8_t *)e->valuestring, len);
+    }
+    else if (type == MB_JSON_Number)
+    {
+        double d = e->valuedouble;
+        // NaN and Infinity were printed as null in JSON
+        if (isnan(d) || isinf(d))
+        {
+            uint8_t b = 0xf6;
+            cborWrite(w, &b, 1);
+        }
+        else if (d == floor(d) && d > -18446744073709551616.0 && d < 18446744073709551616.0)
+        {
+            if (d >= 0)
+                cborWriteHead(w, 0, (uint64_t)d);
+            else
+                cborWriteHead(w, 1, (uint64_t)(-(d + 1)));
+        }
+        else if (sizeof(double) < 8 || (double)(float)d == d)
+        {
+            float f = (float)d;
+            uint32_t bits = 0;
+            memcpy(&bits, &f, 4);
+            uint8_t buf[5] = {0xfa, (uint8_t)(bits >> 24), (uint8_t)(bits >> 16), (uint8_t)(bits >> 8), (uint8_t)bits};
+            cborWrite(w, buf, 5);
+        }
+        else
+        {
+            uint64_t bits = 0;
+            memcpy(&bits, &d, sizeof(double));
+            uint8_t buf[9];
+            buf[0] = 0xfb;
+            for (uint8_t i = 0; i < 8; i++)
+                buf[8 - i] = (uint8_t)(bits >> (8 * i));
+            cborWrite(w, buf, 9);
+        }
+    }
+    else if (type == MB_JSON_Raw)
+    {
+        MB_JSON *raw = MB_JSON_Parse(e->valuestring);
+        if (raw)
+        {
+            cborWriteItem(w, raw);
+            MB_JSON_Delete(raw);
+        }
+        else
+            w.error = true;
+    }
+    else
+    {
+        uint8_t b = type == MB_JSON_True ? 0xf5 : (type == MB_JSON_False ? 0xf4 : 0xf6);
+        cborWrite(w, &b, 1);
+    }
+}
+
+bool FirebaseJsonBase::mFromCBOR(const uint8_t *data, size_t len, Stream *stream, bool array)
+{
+    mClear();
+
+    struct cbor_reader_t r;
+    r.data = data;
+    r.len = len;
+    r.stream = stream;
+
+    uint8_t ib = 0;
+    if (!cborRead(r, &ib, 1))
+        return false;
+
+    // skip the tags e.g. self-described CBOR (55799)
+    while ((ib >> 5) == 6)
+    {
+        uint64_t tag = 0;
+        if (!cborReadArg(r, ib & 0x1f, tag) || !cborRead(r, &ib, 1))
+            return false;
+    }
+
+    // the top level item should be the array (4) for FirebaseJsonArray and the map (5) for FirebaseJson
+    if ((ib >> 5) != (array ? 4 : 5))
+        return false;
+
+    root_type = array ? Root_Type_JSONArray : Root_Type_JSON;
+    root = cborReadItem(r, ib, 0);
+
+    return root != NULL;
+}
+
+bool FirebaseJsonBase::cborRead(cbor_reader_t &r, uint8_t *out, size_t len)
+{
+    if (r.stream)
+        return r.stream->readBytes((char *)out, len) == len;
+
+    if (!r.data || r.len - r.pos < len)
+        return false;
+
+    memcpy(out, r.data + r.pos, len);
+    r.pos += len;
+    return true;
+}
+
+bool FirebaseJsonBase::cborReadArg(cbor_reader_t &r, uint8_t info, uint64_t &val)
+{
+    if (info < 24)
+    {
+        val = info;
+        return true;
+    }
+
+    if (info > 27)
+        return false;
+
+    uint8_t buf[8];
+    uint8_t n = 1 << (info - 24);
+    if (!cborRead(r, buf, n))
+        return false;
+
+    val = 0;
+    for (uint8_t i = 0; i < n; i++)
+        val = (val << 8) | buf[i];
+
+    return true;
+}
+
+char *FirebaseJsonBase::cborReadText(cbor_reader_t &r, uint8_t ib)
+{
+    uint64_t len = 0;
+    if ((ib >> 5) != 3 || !cborReadArg(r, ib & 0x1f, len))
+        return NULL;
+
+    // check the remaining data before allocating the memory for the bogus length
+    if (len >= (size_t)-1 || (!r.stream && r.len - r.pos < len))
+        return NULL;
+
+    char *p = (char *)MB_JSON_malloc((size_t)len + 1);
+    if (!p)
+        return NULL;
+
+    if (!cborRead(r, (uint8_t *)p, (size_t)len))
+    {
+        MB_JSON_free(p);
+        return NULL;
+    }
+
+    p[len] = '\0';
+    return p;
+}
+
+MB_JSON *FirebaseJsonBase::cborReadItem(cbor_reader_t &r, uint8_t ib, int depth)
+{
+    uint8_t major = ib >> 5;
+    uint8_t info = ib & 0x1f;
+    uint64_t val = 0;
+
+    if (depth > MB_JSON_NESTING_LIMIT)
+        return NULL;
+
+    if (major == 7)
+    {
+        if (info == 20)
+            return MB_JSON_CreateFalse();
+        else if (info == 21)
+            return MB_JSON_CreateTrue();
+        else if (info == 22 || info == 23)
+            return MB_JSON_CreateNull();
+        else if (info < 25 || info > 27 || !cborReadArg(r, info, val))
+            return NULL;
+
+        if (info == 25)
+        {
+            // half precision
+            int exp = (val >> 10) & 0x1f;
+            int mant = val & 0x3ff;
+            double d = exp == 0 ? ldexp(mant, -24) : (exp != 31 ? ldexp(mant + 1024, exp - 25) : (mant == 0 ? INFINITY : NAN));
+            return MB_JSON_CreateNumber((val & 0x8000) ? -d : d);
+        }
+        else if (info == 26)
+        {
+            float f = 0;
+            uint32_t bits = (uint32_t)val;
+            memcpy(&f, &bits, 4);
+            return MB_JSON_CreateNumber(f);
+        }
+
+        double d = 0;
+        if (sizeof(double) == 8)
+            memcpy(&d, &val, sizeof(double));
+        else
+        {
+            int exp = (val >> 52) & 0x7ff;
+            uint64_t mant = val & 0xfffffffffffffULL;
+            d = exp == 0 ? ldexp((double)mant, -1074) : (exp != 0x7ff ? ldexp((double)(mant | (1ULL << 52)), exp - 1075) : (mant == 0 ? INFINITY : NAN));
+            if (val >> 63)
+                d = -d;
+        }
+        return MB_JSON_CreateNumber(d);
+    }
+
+    if (major == 3)
+    {
+        char *p = cborReadText(r, ib);
+        if (!p)
+            return NULL;
+        // the node takes the ownership of decoded string
+        MB_JSON *e = MB_JSON_CreateStringReference(p);
+        if (!e)
+        {
+            MB_JSON_free(p);
+            return NULL;
+        }
+        e->type &= ~MB_JSON_IsReference;
+        return e;
+    }
+
+    // indefinite length array and map end with break code
+    bool indefinite = (major == 4 || major == 5) && info == 31;
+    if (!indefinite && !cborReadArg(r, info, val))
+        return NULL;
+
+    if (major == 0)
+        return MB_JSON_CreateNumber((double)val);
+    else if (major == 1)
+        return MB_JSON_CreateNumber(-1.0 - (double)val);
+    else if (major == 6)
+    {
+        // tag, the tagged item is used as it is
+        if (!cborRead(r, &ib, 1))
+            return NULL;
+        return cborReadItem(r, ib, depth + 1);
+    }
+    else if (major != 4 && major != 5)
+        return NULL;
+
+    MB_JSON *e = major == 5 ? MB_JSON_CreateObject() : MB_JSON_CreateArray();
+    if (!e)
+        return NULL;
+
+    bool ret = true;
+    for (uint64_t i = 0; indefinite || i < val; i++)
+    {
+        ret = cborRead(r, &ib, 1);
+        if (!ret || (indefinite && ib == 0xff))
+            break;
+
+        char *key = NULL;
+        if (major == 5)
+        {
+            key = cborReadText(r, ib);
+            ret = key && cborRead(r, &ib, 1);
+        }
+
+        MB_JSON *item = ret ? cborReadItem(r, ib, depth + 1) : NULL;
+        if (!item)
+        {
+            if (key)
+                MB_JSON_free(key);
+            ret = false;
+            break;
+        }
+
+        // the decoded key is owned by the item as it was parsed
+        item->string = key;
+        MB_JSON_AddItemToArray(e, item);
+    }
+
+    if (!ret)
+    {
+        MB_JSON_Delete(e);
+        return NULL;
+    }
+
+    return e;
+}
+
+bool FirebaseJsonBase::mDiff(FirebaseJsonBase &prev, FirebaseJsonBase &result)
+{
+    result.mClear();
+    result.root_type = Root_Type_JSON;
+    result.root = MB_JSON_CreateObject();
+    if (!result.root)
+        return false;
+
+    MB_String path;
+    MB_JSON *cur = isContainer(root) ? root : NULL;
+    MB_JSON *old = isContainer(prev.root) ? prev.root : NULL;
+
+    if (cur && old && (cur->type & 0xff) == (old->type & 0xff))
+        mDiffChildren(cur, old, path, result.root);
+    else
+    {
+        // the whole content was replaced, the current members are set and the
+        // previous members that were not set (by key or index) are removed
+        int index = 0;
+        for (MB_JSON *e = cur ? cur->child : NULL; e; e = e->next, index++)
+            mAddDiff(result.root, path, e, index, e);
+        index = 0;
+        for (MB_JSON *e = old ? old->child : NULL; e; e = e->next, index++)
+        {
+            mAddDiffKey(path, e, index);
+            bool replaced = MB_JSON_GetObjectItemCaseSensitive(result.root, path.c_str()) != NULL;
+            path.clear();
+            if (!replaced)
+                mAddDiff(result.root, path, e, index, NULL);
+        }
+    }
+
+    return true;
+}
+
+bool FirebaseJsonBase::isContainer(MB_JSON *e)
+{
+    return e && (isObject(e) || isArray(e));
+}
+
+void FirebaseJsonBase::mAddDiffKey(MB_String &path, MB_JSON *key, int index)
+{
+    if (path.length() > 0)
+        path += '/';
+
+    if (!key->string)
+    {
+        path += index;
+        return;
+    }
+
+    // escape the path separator in key as JSON Pointer
+    for (const char *p = key->string; *p; p++)
+    {
+        if (*p == '~')
+            path += "~0";
+        else if (*p == '/')
+            path += "~1";
+        else
+            path += *p;
+    }
+}
+
+void FirebaseJsonBase::mAddDiff(MB_JSON *out, MB_String &path, MB_JSON *key, int index, MB_JSON *value)
+{
+    size_t len = path.length();
+    mAddDiffKey(path, key, index);
+
+    MB_JSON_AddItemToObject(out, path.c_str(), value ? MB_JSON_Duplicate(value, true) : MB_JSON_CreateNull());
+    path.erase(len);
+}
+
+void FirebaseJsonBase::mDiffChildren(MB_JSON *cur, MB_JSON *prev, MB_String &path, MB_JSON *out)
+{
+    bool arr = isArray(cur);
+    int index = 0;
+    MB_JSON *p = arr ? prev->child : NULL;
+
+    for (MB_JSON *c = cur->child; c; c = c->next, index++)
+    {
+        // the array elements are paired by index, the object members by key
+        MB_JSON *o = arr ? p : MB_JSON_GetObjectItemCaseSensitive(prev, c->string);
+
+        if (!o)
+            mAddDiff(out, path, c, index, c);
+        else if (isContainer(c) && (c->type & 0xff) == (o->type & 0xff))
+        {
+            size_t len = path.length();
+            mAddDiffKey(path, c, index);
+
+            if (c->child || o->child)
+                mDiffChildren(c, o, path, out);
+            path.erase(len);
+        }
+        else if (!MB_JSON_Compare(c, o, true))
+            mAddDiff(out, path, c, index, c);
+
+        if (p)
+            p = p->next;
+    }
+
+    // removed nodes
+    if (arr)
+    {
+        for (; p; p = p->next, index++)
+            mAddDiff(out, path, p, index, NULL);
+    }
+    else
+    {
+        for (MB_JSON *o = prev->child; o; o = o->next)
+        {
+            if (!MB_JSON_GetObjectItemCaseSensitive(cur, o->string))
+                mAddDiff(out, path, o, 0, NULL);
+        }
+    }
+}
+
 const char *FirebaseJsonBase::mRaw()
 {
     toBuf(fb_json_serialize_mode_plain);
@@ -598,6 +1240,7 @@ bool FirebaseJsonBase::mRemove(const char *path)
 {
     bool ret = false;
     prepareRoot();
+    ownRoot();
     MB_VECTOR<MB_String> keys = MB_VECTOR<MB_String>();
     makeList(path, keys, '/');
 
@@ -711,7 +1354,7 @@ bool FirebaseJsonBase::mGet(MB_JSON *parent, FirebaseJsonData *result, const cha
                 char *p = prettify ? MB_JSON_Print(data) : MB_JSON_PrintUnformatted(data);
                 result->stringValue = p;
                 MB_JSON_free(p);
-                result->type_num = data->type;
+                result->type_num = data->type & 0xff;
                 result->success = true;
                 mSetElementType(result);
             }
@@ -723,34 +1366,39 @@ bool FirebaseJsonBase::mGet(MB_JSON *parent, FirebaseJsonData *result, const cha
     return ret;
 }
 
-void FirebaseJsonBase::mSetResInt(FirebaseJsonData *data, const char *value)
+void FirebaseJsonBase::mSetResNum(FirebaseJsonData *data, const char *value, MB_JSON_NumberInfo &info)
 {
-    if (strlen(value) > 0)
+    // skip the leading spaces as strtod does
+    while (*value == ' ' || *value == '\t' || *value == '\r' || *value == '\n')
+        value++;
+
+    if (MB_JSON_ScanNumber(value, strlen(value), &info) > 0)
     {
-        char *pEnd;
-#if !defined(__AVR__)
-        value[0] == '-' ? data->iVal.int64 = strtoll(value, &pEnd, 10) : data->iVal.uint64 = strtoull(value, &pEnd, 10);
-#else
-        value[0] == '-' ? data->iVal.int64 = strtol(value, &pEnd, 10) : data->iVal.uint64 = strtoull_alt(value);
-#endif
+        if (info.type == MB_JSON_NumberFloat)
+        {
+            // saturate the integer value as strtoll and strtoull do
+            if (info.value >= 9223372036854775807.0)
+                data->iVal.uint64 = info.value >= 18446744073709551615.0 ? 0xffffffffffffffffULL : (uint64_t)info.value;
+            else if (info.value <= -9223372036854775807.0)
+                data->iVal.int64 = (int64_t)(-9223372036854775807LL - 1);
+            else
+                data->iVal.int64 = (int64_t)info.value;
+        }
+        else if (info.negative)
+            data->iVal.int64 = (int64_t)(0 - info.integer);
+        else
+            data->iVal.uint64 = info.integer;
+
+        data->fVal.setd(info.value);
     }
     else
+    {
         data->iVal = {0};
+        data->fVal.setd(0);
+    }
 
     data->intValue = data->iVal.int32;
     data->boolValue = data->iVal.int32 > 0;
-}
-
-void FirebaseJsonBase::mSetResFloat(FirebaseJsonData *data, const char *value)
-{
-    if (strlen(value) > 0)
-    {
-        char *pEnd;
-        data->fVal.setd(strtod(value, &pEnd));
-    }
-    else
-        data->fVal.setd(0);
-
     data->doubleValue = data->fVal.d;
     data->floatValue = data->fVal.f;
 }
@@ -786,8 +1434,8 @@ void FirebaseJsonBase::mSetElementType(FirebaseJsonData *result)
         // try casting the string to numbers
         if (result->stringValue.length() <= 32)
         {
-            mSetResInt(result, result->stringValue.c_str());
-            mSetResFloat(result, result->stringValue.c_str());
+            MB_JSON_NumberInfo info;
+            mSetResNum(result, result->stringValue.c_str(), info);
         }
     }
     else if (result->type_num == MB_JSON_NULL)
@@ -810,13 +1458,12 @@ void FirebaseJsonBase::mSetElementType(FirebaseJsonData *result)
     }
     else if (result->type_num == MB_JSON_Number || result->type_num == MB_JSON_Raw)
     {
-        mSetResInt(result, result->stringValue.c_str());
-        mSetResFloat(result, result->stringValue.c_str());
+        MB_JSON_NumberInfo info;
+        mSetResNum(result, result->stringValue.c_str(), info);
 
-        if (strpos(result->stringValue.c_str(), (const char *)MBSTRING_FLASH_MCR("."), 0) > -1)
+        if (info.type == MB_JSON_NumberFloat)
         {
-            double d = atof(result->stringValue.c_str());
-            if (d > 0x7fffffff)
+            if (info.value > 0x7fffffff)
             {
                 strcpy(buf, (const char *)MBSTRING_FLASH_MCR("double"));
                 result->typeNum = JSON_DOUBLE;
@@ -841,6 +1488,7 @@ void FirebaseJsonBase::mSetElementType(FirebaseJsonData *result)
 void FirebaseJsonBase::mSet(const char *path, MB_JSON *value)
 {
     prepareRoot();
+    ownRoot();
     MB_VECTOR<MB_String> keys = MB_VECTOR<MB_String>();
     makeList(path, keys, '/');
 
@@ -874,29 +1522,40 @@ void FirebaseJsonBase::mSet(const char *path, MB_JSON *value)
     clearList(keys);
 }
 
-#if defined(__AVR__)
-unsigned long long FirebaseJsonBase::strtoull_alt(const char *s)
+FirebaseJson &FirebaseJson::operator=(const FirebaseJson &other)
 {
-    unsigned long long sum = 0;
-    while (*s)
-    {
-        sum = sum * 10 + (*s++ - '0');
-    }
-    return sum;
+    FirebaseJson &src = const_cast<FirebaseJson &>(other);
+    if (isObject(src.root))
+        mCopy(src);
+    return *this;
 }
-#endif
 
-FirebaseJson &FirebaseJson::operator=(FirebaseJson other)
+FirebaseJson &FirebaseJson::operator=(FirebaseJson &&other)
 {
     if (isObject(other.root))
-        mCopy(other);
+        mMove(other);
     return *this;
 }
 
-FirebaseJson::FirebaseJson(FirebaseJson &other)
+FirebaseJson::FirebaseJson(const FirebaseJson &other)
 {
+    FirebaseJson &src = const_cast<FirebaseJson &>(other);
+    if (isObject(src.root))
+        mCopy(src);
+}
+
+FirebaseJson &FirebaseJson::share(FirebaseJson &other)
+{
+    // sharing only updates the reference count of the other object
     if (isObject(other.root))
-        mCopy(other);
+        mShare(other);
+    return *this;
+}
+
+FirebaseJson::FirebaseJson(FirebaseJson &&other)
+{
+    if (isObject(other.root))
+        mMove(other);
 }
 
 FirebaseJson::~FirebaseJson()
@@ -907,6 +1566,7 @@ FirebaseJson::~FirebaseJson()
 FirebaseJson &FirebaseJson::nAdd(const char *key, MB_JSON *value)
 {
     prepareRoot();
+    ownRoot();
     MB_VECTOR<MB_String> keys = MB_VECTOR<MB_String>();
     // makeList(key, keys, '/');
     MB_String ky = key;
@@ -937,17 +1597,40 @@ FirebaseJsonArray::~FirebaseJsonArray()
     mClear();
 };
 
-FirebaseJsonArray &FirebaseJsonArray::operator=(FirebaseJsonArray other)
+FirebaseJsonArray &FirebaseJsonArray::operator=(const FirebaseJsonArray &other)
+{
+    FirebaseJsonArray &src = const_cast<FirebaseJsonArray &>(other);
+    if (isArray(src.root))
+        mCopy(src);
+    return *this;
+}
+
+FirebaseJsonArray &FirebaseJsonArray::operator=(FirebaseJsonArray &&other)
 {
     if (isArray(other.root))
-        mCopy(other);
+        mMove(other);
     return *this;
 }
 
-FirebaseJsonArray::FirebaseJsonArray(FirebaseJsonArray &other)
+FirebaseJsonArray::FirebaseJsonArray(const FirebaseJsonArray &other)
+{
+    FirebaseJsonArray &src = const_cast<FirebaseJsonArray &>(other);
+    if (isArray(src.root))
+        mCopy(src);
+}
+
+FirebaseJsonArray &FirebaseJsonArray::share(FirebaseJsonArray &other)
 {
+    // sharing only updates the reference count of the other object
     if (isArray(other.root))
-        mCopy(other);
+        mShare(other);
+    return *this;
+}
+
+FirebaseJsonArray::FirebaseJsonArray(FirebaseJsonArray &&other)
+{
+    if (isArray(other.root))
+        mMove(other);
 }
 
 FirebaseJsonArray &FirebaseJsonArray::nAdd(MB_JSON *value)
@@ -958,6 +1641,7 @@ FirebaseJsonArray &FirebaseJsonArray::nAdd(MB_JSON *value)
     root_type = Root_Type_JSONArray;
 
     prepareRoot();
+    ownRoot();
 
     if (value == NULL)
         value = MB_JSON_CreateNull();
@@ -983,7 +1667,7 @@ bool FirebaseJsonArray::mGetIdx(FirebaseJsonData *result, int index, bool pretti
         char *p = prettify ? MB_JSON_Print(data) : MB_JSON_PrintUnformatted(data);
         result->stringValue = p;
         MB_JSON_free(p);
-        result->type_num = data->type;
+        result->type_num = data->type & 0xff;
         result->success = true;
         mSetElementType(result);
         ret = true;
@@ -999,6 +1683,7 @@ bool FirebaseJsonArray::mSetIdx(int index, MB_JSON *value)
     root_type = Root_Type_JSONArray;
 
     prepareRoot();
+    ownRoot();
 
     int size = MB_JSON_GetArraySize(root);
     if (index < size)
@@ -1017,6 +1702,7 @@ bool FirebaseJsonArray::mSetIdx(int index, MB_JSON *value)
 
 bool FirebaseJsonArray::mRemoveIdx(int index)
 {
+    ownRoot();
     int size = MB_JSON_GetArraySize(root);
     if (index < size)
     {
@@ -1046,6 +1732,16 @@ FirebaseJsonArray &FirebaseJsonArray::add(FirebaseJsonArray &value)
     return *this;
 }
 
+FirebaseJsonArray &FirebaseJsonArray::add(FirebaseJson &&value)
+{
+    return nAdd(value.takeRoot());
+}
+
+FirebaseJsonArray &FirebaseJsonArray::add(FirebaseJsonArray &&value)
+{
+    return nAdd(value.takeRoot());
+}
+
 FirebaseJsonData::FirebaseJsonData()
 {
 }
@@ -1065,8 +1761,7 @@ bool FirebaseJsonData::getArray(FirebaseJsonArray &jsonArray)
 bool FirebaseJsonData::mGetArray(const char *source, FirebaseJsonArray &jsonArray)
 {
 
-    if (jsonArray.root != NULL)
-        MB_JSON_Delete(jsonArray.root);
+    jsonArray.releaseRoot();
 
     jsonArray.root = jsonArray.parse(source);
 
@@ -1082,8 +1777,7 @@ bool FirebaseJsonData::getJSON(FirebaseJson &json)
 
 bool FirebaseJsonData::mGetJSON(const char *source, FirebaseJson &json)
 {
-    if (json.root != NULL)
-        MB_JSON_Delete(json.root);
+    json.releaseRoot();
 
     json.root = json.parse(source);
 
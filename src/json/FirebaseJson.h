@@ -149,6 +149,11 @@ extern "C"
 
 #define MB_SERIAL_CLASS decltype(Serial)
 
+// The size of the buffer that the JSON is serialized through when it is written to the Print object or the internal buffer.
+#ifndef FIREBASE_JSON_PRINT_CHUNK_SIZE
+#define FIREBASE_JSON_PRINT_CHUNK_SIZE 256
+#endif
+
 #ifdef Serial_Printf
 #undef Serial_Printf
 #endif
@@ -203,6 +208,7 @@ static const char fb_json_str_9[] PROGMEM = "Location: ";
 class FirebaseJson;
 class FirebaseJsonArray;
 class FirebaseJsonData;
+class FirebaseJsonQuery;
 
 static size_t getReservedLen(size_t len)
 {
@@ -347,7 +353,7 @@ public:
     template <typename T>
     bool getArray(T source, FirebaseJsonArray &jsonArray)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = mGetArray(getStr(source, addr), jsonArray);
         delAddr(addr);
         return ret;
@@ -374,7 +380,7 @@ public:
     template <typename T>
     bool getJSON(T source, FirebaseJson &json)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = mGetJSON(getStr(source, addr), json);
         delAddr(addr);
         return ret;
@@ -517,20 +523,20 @@ private:
     void *newP(size_t len);
 
     template <typename T>
-    auto getStr(const T &val, uint32_t &addr) -> typename std::enable_if<is_std_string<T>::value || is_arduino_string<T>::value || is_mb_string<T>::value || std::is_same<T, StringSumHelper>::value, const char *>::type
+    auto getStr(const T &val, uintptr_t &addr) -> typename std::enable_if<is_std_string<T>::value || is_arduino_string<T>::value || is_mb_string<T>::value || std::is_same<T, StringSumHelper>::value, const char *>::type
     {
         addr = 0;
         return val.c_str();
     }
 
     template <typename T>
-    auto getStr(T val, uint32_t &addr) -> typename std::enable_if<is_arduino_flash_string_helper<T>::value, const char *>::type
+    auto getStr(T val, uintptr_t &addr) -> typename std::enable_if<is_arduino_flash_string_helper<T>::value, const char *>::type
     {
         return getStr(reinterpret_cast<PGM_P>(val), addr);
     }
 
     template <typename T>
-    auto getStr(T val, uint32_t &addr) -> typename std::enable_if<is_const_chars<T>::value, const char *>::type
+    auto getStr(T val, uintptr_t &addr) -> typename std::enable_if<is_const_chars<T>::value, const char *>::type
     {
         int len = strlen_P((PGM_P)val) + 1;
         char *out = (char *)newP(len);
@@ -541,7 +547,7 @@ private:
         return (const char *)out;
     }
 
-    void delAddr(uint32_t addr)
+    void delAddr(uintptr_t addr)
     {
         if (addr > 0)
         {
@@ -557,6 +563,7 @@ class FirebaseJsonBase
     friend class FirebaseJson;
     friend class FirebaseJsonArray;
     friend class FirebaseJsonData;
+    friend class FirebaseJsonQuery;
 
 private:
     typedef enum
@@ -612,11 +619,30 @@ private:
         String value;
     };
 
+    struct cbor_writer_t
+    {
+        Print *print = NULL;
+        MB_VECTOR<uint8_t> *vec = NULL;
+        bool error = false;
+    };
+
+    struct cbor_reader_t
+    {
+        const uint8_t *data = NULL;
+        size_t len = 0;
+        size_t pos = 0;
+        Stream *stream = NULL;
+    };
+
     FirebaseJsonBase &mClear();
+    void releaseRoot();
+    void ownRoot();
     void mIteratorEnd(bool clearBuf = true);
-    bool setRaw(const char *raw);
+    bool setRaw(const char *raw, bool insitu = false);
+    bool setRawInSitu(MB_String &raw);
     void prepareRoot();
     MB_JSON *parse(const char *raw);
+    MB_JSON *parseInSitu(MB_String &raw);
     void searchElements(MB_VECTOR<MB_String> &keys, MB_JSON *parent, struct search_result_t &r);
     MB_JSON *getElement(MB_JSON *parent, const char *key, struct search_result_t &r);
     void mAdd(MB_VECTOR<MB_String> keys, MB_JSON **parent, int beginIndex, MB_JSON *value);
@@ -649,14 +675,27 @@ private:
     void mSetDoubleDigits(uint8_t digits);
     int mResponseCode();
     bool mGet(MB_JSON *parent, FirebaseJsonData *result, const char *path, bool prettify = false);
-    void mSetResInt(FirebaseJsonData *data, const char *value);
-    void mSetResFloat(FirebaseJsonData *data, const char *value);
+    void mSetResNum(FirebaseJsonData *data, const char *value, MB_JSON_NumberInfo &info);
     void mSetElementType(FirebaseJsonData *result);
     void mSet(const char *path, MB_JSON *value);
     void mCopy(FirebaseJsonBase &other);
-#if defined(__AVR__)
-    unsigned long long strtoull_alt(const char *s);
-#endif
+    void mShare(FirebaseJsonBase &other);
+    void mMove(FirebaseJsonBase &other);
+    MB_JSON *takeRoot();
+    bool mToCBOR(Print *print, MB_VECTOR<uint8_t> *vec);
+    bool mFromCBOR(const uint8_t *data, size_t len, Stream *stream, bool array);
+    void cborWrite(cbor_writer_t &w, const uint8_t *data, size_t len);
+    void cborWriteHead(cbor_writer_t &w, uint8_t major, uint64_t val);
+    void cborWriteItem(cbor_writer_t &w, MB_JSON *e);
+    bool cborRead(cbor_reader_t &r, uint8_t *out, size_t len);
+    bool cborReadArg(cbor_reader_t &r, uint8_t info, uint64_t &val);
+    char *cborReadText(cbor_reader_t &r, uint8_t ib);
+    MB_JSON *cborReadItem(cbor_reader_t &r, uint8_t ib, int depth);
+    bool mDiff(FirebaseJsonBase &prev, FirebaseJsonBase &result);
+    bool isContainer(MB_JSON *e);
+    void mAddDiffKey(MB_String &path, MB_JSON *key, int index);
+    void mAddDiff(MB_JSON *out, MB_String &path, MB_JSON *key, int index, MB_JSON *value);
+    void mDiffChildren(MB_JSON *cur, MB_JSON *prev, MB_String &path, MB_JSON *out);
 
 public:
     enum fb_json_root_type
@@ -701,11 +740,15 @@ protected:
     fb_json_root_type root_type = Root_Type_JSON;
     struct iterator_data_t iterator_data;
     MB_JSON *root = NULL;
+    // reference count of the root shared between copies, NULL when the root is owned exclusively
+    int *shared = NULL;
     MB_JSON_Hooks *hooks = NULL;
     MB_String buf;
+    // backing buffer of the elements parsed in-situ, their keys and strings point into it
+    MB_String insitu_buf;
 
     template <typename T>
-    auto getStr(T val, uint32_t &addr) -> typename std::enable_if<is_bool<T>::value || is_num_int<T>::value || std::is_same<T, float>::value || std::is_same<T, double>::value || std::is_same<T, long double>::value, const char *>::type
+    auto getStr(T val, uintptr_t &addr) -> typename std::enable_if<is_bool<T>::value || is_num_int<T>::value || std::is_same<T, float>::value || std::is_same<T, double>::value || std::is_same<T, long double>::value, const char *>::type
     {
         MB_String t;
 
@@ -726,20 +769,20 @@ protected:
     }
 
     template <typename T>
-    auto getStr(const T &val, uint32_t &addr) -> typename std::enable_if<is_std_string<T>::value || is_arduino_string<T>::value || is_mb_string<T>::value || std::is_same<T, StringSumHelper>::value, const char *>::type
+    auto getStr(const T &val, uintptr_t &addr) -> typename std::enable_if<is_std_string<T>::value || is_arduino_string<T>::value || is_mb_string<T>::value || std::is_same<T, StringSumHelper>::value, const char *>::type
     {
         addr = 0;
         return val.c_str();
     }
 
     template <typename T>
-    auto getStr(T val, uint32_t &addr) -> typename std::enable_if<is_arduino_flash_string_helper<T>::value, const char *>::type
+    auto getStr(T val, uintptr_t &addr) -> typename std::enable_if<is_arduino_flash_string_helper<T>::value, const char *>::type
     {
         return getStr(reinterpret_cast<PGM_P>(val), addr);
     }
 
     template <typename T>
-    auto getStr(T val, uint32_t &addr) -> typename std::enable_if<is_const_chars<T>::value, const char *>::type
+    auto getStr(T val, uintptr_t &addr) -> typename std::enable_if<is_const_chars<T>::value, const char *>::type
     {
         int len = strlen_P((PGM_P)val) + 1;
         char *out = (char *)newP(len);
@@ -788,14 +831,7 @@ protected:
     template <typename T>
     auto toStringHandler(T &out, bool prettify) -> typename std::enable_if<std::is_same<T, MB_SERIAL_CLASS>::value, bool>::type
     {
-        char *p = prettify ? MB_JSON_Print(root) : MB_JSON_PrintUnformatted(root);
-        if (p)
-        {
-            out.print(p);
-            MB_JSON_free(p);
-            return true;
-        }
-        return false;
+        return writeStream(out, prettify);
     }
 
     template <typename T>
@@ -820,23 +856,24 @@ protected:
 #endif
 #endif
 
-    template <typename T>
-    bool writeStream(T &out, bool prettify)
+    static size_t printWriter(void *context, const char *data, size_t len)
     {
-        bool ret = false;
+        return reinterpret_cast<Print *>(context)->write((const uint8_t *)data, len);
+    }
 
+    static size_t stringWriter(void *context, const char *data, size_t len)
+    {
+        reinterpret_cast<MB_String *>(context)->append(data, len);
+        return len;
+    }
+
+    // Serialize in chunks instead of printing the whole JSON to the memory first.
+    bool writeStream(Print &out, bool prettify)
+    {
         if (!root)
             return false;
 
-        char *p = prettify ? MB_JSON_Print(root) : MB_JSON_PrintUnformatted(root);
-        if (p)
-        {
-            ret = out.write((const uint8_t *)p, strlen(p)) == strlen(p);
-            MB_JSON_free(p);
-            return ret;
-        }
-
-        return ret;
+        return MB_JSON_PrintToWriter(root, prettify, FIREBASE_JSON_PRINT_CHUNK_SIZE, printWriter, &out);
     }
 
     void idle()
@@ -1718,6 +1755,7 @@ class FirebaseJsonArray : public FirebaseJsonBase
 
     friend class FirebaseJson;
     friend class FirebaseJsonData;
+    friend class FirebaseJsonQuery;
 
 public:
     typedef struct FirebaseJsonBase::fb_js_iterator_value_t IteratorValue;
@@ -1734,10 +1772,26 @@ public:
         setJsonArrayData(data);
     }
 
-    FirebaseJsonArray &operator=(FirebaseJsonArray other);
-    FirebaseJsonArray(FirebaseJsonArray &other);
+    /**
+     * Copies are deep copies, use share() to avoid copying the data.
+     * The temporary (rvalue) objects are moved without copying.
+     */
+    FirebaseJsonArray &operator=(const FirebaseJsonArray &other);
+    FirebaseJsonArray &operator=(FirebaseJsonArray &&other);
+    FirebaseJsonArray(const FirebaseJsonArray &other);
+    FirebaseJsonArray(FirebaseJsonArray &&other);
     ~FirebaseJsonArray();
 
+    /**
+     * Share the JSON array data of other object until one of them is modified (copy-on-write).
+     *
+     * @param other The FirebaseJsonArray object to share.
+     * @return instance of an object.
+     *
+     * @note The shared objects (and the objects that they were shared with) should not be used from different tasks.
+     */
+    FirebaseJsonArray &share(FirebaseJsonArray &other);
+
     /**
      * Set or deserialize the JSON array data (JSON array literal) as FirebaseJsonArray object.
      *
@@ -1749,12 +1803,44 @@ public:
     template <typename T>
     bool setJsonArrayData(T data)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = setRaw(getStr(data, addr));
         delAddr(addr);
         return ret;
     }
 
+    /**
+     * Deserialize the JSON array data (JSON array literal) in-situ as FirebaseJsonArray object.
+     *
+     * @param data The JSON array literal string to deserialize.
+     * @return boolean status of the operation.
+     *
+     * @note The literal is copied once to the internal buffer which the keys and strings of the elements point to
+     * instead of allocating each of them, this suits the large payload that mostly read.
+     * The copy holds the whole literal while the object keeps its data, use moveJsonArrayDataInSitu to parse
+     * in the MB_String buffer without the copy.
+     * Call FirebaseJsonArray.errorPosition to get the error.
+     */
+    template <typename T>
+    bool setJsonArrayDataInSitu(T data)
+    {
+        uintptr_t addr = 0;
+        bool ret = setRaw(getStr(data, addr), true);
+        delAddr(addr);
+        return ret;
+    }
+
+    /**
+     * Deserialize the JSON array literal in-situ in its own buffer as FirebaseJsonArray object.
+     *
+     * @param data The JSON array literal string to deserialize, its buffer is moved to FirebaseJsonArray object
+     * without copy and data is left empty.
+     * @return boolean status of the operation.
+     *
+     * @note Call FirebaseJsonArray.errorPosition to get the error.
+     */
+    bool moveJsonArrayDataInSitu(MB_String &data) { return setRawInSitu(data); }
+
     /**
      * Add null to FirebaseJsonArray object.
      *
@@ -1779,6 +1865,11 @@ public:
 
     FirebaseJsonArray &add(FirebaseJsonArray &value);
 
+    // the temporary (rvalue) object's data are moved into the array without copying
+    FirebaseJsonArray &add(FirebaseJson &&value);
+
+    FirebaseJsonArray &add(FirebaseJsonArray &&value);
+
     /**
      * Add multiple values to FirebaseJsonArray object.
      * e.g. add("a","b",1,2)
@@ -1858,7 +1949,7 @@ public:
     template <typename T>
     bool isMember(T path)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = mGet(root, NULL, getStr(path, addr));
         delAddr(addr);
         return ret;
@@ -1912,12 +2003,15 @@ public:
      *
      * @param out The object e.g. Serial, String, std::string, char array, Stream, File, Client, that accepts the returning string.
      * @param prettify The text indentation and new line serialization option.
+     * @note The Print object e.g. Serial, File and Client, receives the string in chunks of FIREBASE_JSON_PRINT_CHUNK_SIZE bytes.
      */
     template <typename T>
     bool toString(T *ptr, bool prettify = false) { return toStringPtrHandler(ptr, prettify); }
 
     bool toString(Stream &out, bool prettify = false) { return toStringHandler(out, prettify); }
 
+    bool toString(Print &out, bool prettify = false) { return writeStream(out, prettify); }
+
     bool toString(String &out, bool prettify = false) { return toStringHandler(out, prettify); }
 
     bool toString(MB_String &out, bool prettify = false) { return toStringHandler(out, prettify); }
@@ -1929,6 +2023,34 @@ public:
     }
 #endif
 
+    /**
+     * Serialize the FirebaseJsonArray object to CBOR (RFC 8949) binary data.
+     *
+     * @param out The Print object e.g. File, WiFi/Ethernet Client and Serial, or the vector of bytes that accepts the encoded data.
+     * @return boolean status of the operation.
+     *
+     * @note The binary is smaller and faster to deserialize than the JSON string when keeping the data in flash
+     * or passing it between tasks.
+     */
+    bool toCBOR(Print &out) { return mToCBOR(&out, NULL); }
+
+    bool toCBOR(MB_VECTOR<uint8_t> &out) { return mToCBOR(NULL, &out); }
+
+    /**
+     * Deserialize the CBOR (RFC 8949) binary data as FirebaseJsonArray object.
+     *
+     * @param data The CBOR data buffer, vector of bytes or Stream object e.g. File and WiFi/Ethernet Client to read.
+     * @param len The length of data buffer.
+     * @return boolean status of the operation.
+     *
+     * @note The top level item should be the array, byte strings and indefinite length text strings are not supported.
+     */
+    bool fromCBOR(const uint8_t *data, size_t len) { return mFromCBOR(data, len, NULL, true); }
+
+    bool fromCBOR(MB_VECTOR<uint8_t> &data) { return data.size() > 0 && mFromCBOR(&data[0], data.size(), NULL, true); }
+
+    bool fromCBOR(Stream &in) { return mFromCBOR(NULL, 0, &in, true); }
+
     /**
      * Get raw JSON Array
      * @return raw JSON Array string
@@ -2016,7 +2138,7 @@ private:
     template <typename T>
     auto dataGetHandler(T arg, FirebaseJsonData &result, bool prettify) -> typename std::enable_if<is_string<T>::value, bool>::type
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = mGet(root, &result, getStr(arg, addr), prettify);
         delAddr(addr);
         return ret;
@@ -2031,7 +2153,7 @@ private:
     template <typename T>
     auto dataRemoveHandler(T arg) -> typename std::enable_if<is_string<T>::value, bool>::type
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = mRemove(getStr(arg, addr));
         delAddr(addr);
         return ret;
@@ -2099,7 +2221,7 @@ private:
 
         root_type = Root_Type_JSONArray;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         nAdd(MB_JSON_CreateString(getStr(arg, addr)));
         delAddr(addr);
         return *this;
@@ -2114,7 +2236,7 @@ private:
 
         root_type = Root_Type_JSONArray;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         mSet(getStr(arg1, addr), MB_JSON_CreateNull());
         delAddr(addr);
     }
@@ -2134,7 +2256,7 @@ private:
 
         root_type = Root_Type_JSONArray;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         mSet(getStr(arg1, addr), MB_JSON_CreateBool(arg2));
         delAddr(addr);
     }
@@ -2153,7 +2275,7 @@ private:
 
         root_type = Root_Type_JSONArray;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         mSet(getStr(arg1, addr), MB_JSON_CreateRaw(num2Str(arg2, -1)));
         delAddr(addr);
     }
@@ -2172,7 +2294,7 @@ private:
 
         root_type = Root_Type_JSONArray;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         mSet(getStr(arg1, addr), MB_JSON_CreateRaw(num2Str(arg2, floatDigits)));
         delAddr(addr);
     }
@@ -2191,7 +2313,7 @@ private:
 
         root_type = Root_Type_JSONArray;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         mSet(getStr(arg1, addr), MB_JSON_CreateRaw(num2Str(arg2, doubleDigits)));
         delAddr(addr);
     }
@@ -2210,8 +2332,8 @@ private:
 
         root_type = Root_Type_JSONArray;
 
-        uint32_t addr1 = 0;
-        uint32_t addr2 = 0;
+        uintptr_t addr1 = 0;
+        uintptr_t addr2 = 0;
         mSet(getStr(arg1, addr1), MB_JSON_CreateString(getStr(arg2, addr2)));
         delAddr(addr1);
         delAddr(addr2);
@@ -2220,7 +2342,7 @@ private:
     template <typename T1, typename T2>
     auto dataSetHandler(T1 arg1, T2 arg2) -> typename std::enable_if<(is_num_int<T1>::value || is_num_float<T1>::value || is_bool<T1>::value) && is_string<T2>::value>::type
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         mSetIdx(arg1, MB_JSON_CreateString(getStr(arg2, addr)));
         delAddr(addr);
     }
@@ -2234,7 +2356,7 @@ private:
         root_type = Root_Type_JSONArray;
 
         MB_JSON *e = MB_JSON_Duplicate(arg2.root, true);
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         mSet(getStr(arg1, addr), e);
         delAddr(addr);
     }
@@ -2255,7 +2377,7 @@ private:
         root_type = Root_Type_JSONArray;
 
         MB_JSON *e = MB_JSON_Duplicate(arg2.root, true);
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         mSet(getStr(arg1, addr), e);
         delAddr(addr);
     }
@@ -2267,7 +2389,7 @@ private:
         mSetIdx(arg1, e);
     }
 
-    void delAddr(uint32_t addr)
+    void delAddr(uintptr_t addr)
     {
         if (addr > 0)
         {
@@ -2296,12 +2418,30 @@ public:
         setJsonData(data);
     }
 
-    FirebaseJson &operator=(FirebaseJson other);
+    /**
+     * Copies are deep copies, use share() to avoid copying the data.
+     * The temporary (rvalue) objects are moved without copying.
+     */
+    FirebaseJson &operator=(const FirebaseJson &other);
+
+    FirebaseJson &operator=(FirebaseJson &&other);
+
+    FirebaseJson(const FirebaseJson &other);
 
-    FirebaseJson(FirebaseJson &other);
+    FirebaseJson(FirebaseJson &&other);
 
     ~FirebaseJson();
 
+    /**
+     * Share the JSON object data of other object until one of them is modified (copy-on-write).
+     *
+     * @param other The FirebaseJson object to share.
+     * @return instance of an object.
+     *
+     * @note The shared objects (and the objects that they were shared with) should not be used from different tasks.
+     */
+    FirebaseJson &share(FirebaseJson &other);
+
     /**
      * Clear internal buffer of FirebaseJson object.
      *
@@ -2320,12 +2460,44 @@ public:
     template <typename T>
     bool setJsonData(T data)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = setRaw(getStr(data, addr));
         delAddr(addr);
         return ret;
     }
 
+    /**
+     * Deserialize the JSON object literal in-situ as FirebaseJson object.
+     *
+     * @param data The JSON object literal string to deserialize.
+     * @return boolean status of the operation.
+     *
+     * @note The literal is copied once to the internal buffer which the keys and strings of the elements point to
+     * instead of allocating each of them, this suits the large payload that mostly read.
+     * The copy holds the whole literal while the object keeps its data, use moveJsonDataInSitu to parse
+     * in the MB_String buffer without the copy.
+     * Call FirebaseJson.errorPosition to get the error.
+     */
+    template <typename T>
+    bool setJsonDataInSitu(T data)
+    {
+        uintptr_t addr = 0;
+        bool ret = setRaw(getStr(data, addr), true);
+        delAddr(addr);
+        return ret;
+    }
+
+    /**
+     * Deserialize the JSON object literal in-situ in its own buffer as FirebaseJson object.
+     *
+     * @param data The JSON object literal string to deserialize, its buffer is moved to FirebaseJson object
+     * without copy and data is left empty.
+     * @return boolean status of the operation.
+     *
+     * @note Call FirebaseJson.errorPosition to get the error.
+     */
+    bool moveJsonDataInSitu(MB_String &data) { return setRawInSitu(data); }
+
     /**
      * Set JSON data via derived Stream object to FirebaseJson object.
      *
@@ -2370,7 +2542,7 @@ public:
     template <typename T>
     FirebaseJson &add(T key)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         nAdd(getStr(key, addr), NULL);
         delAddr(addr);
         return *this;
@@ -2386,7 +2558,7 @@ public:
     template <typename T1, typename T2>
     FirebaseJson &add(T1 key, T2 value)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         dataHandler(getStr(key, addr), value, fb_json_func_type_add);
         delAddr(addr);
         return *this;
@@ -2395,26 +2567,45 @@ public:
     template <typename T>
     FirebaseJson &add(T key, FirebaseJson &value)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         dataHandler(getStr(key, addr), value, fb_json_func_type_add);
         delAddr(addr);
         return *this;
     }
 
+    template <typename T>
+    FirebaseJson &add(T key, FirebaseJson &&value)
+    {
+        uintptr_t addr = 0;
+        nodeHandler(getStr(key, addr), value.takeRoot(), fb_json_func_type_add);
+        delAddr(addr);
+        return *this;
+    }
+
     template <typename T>
     FirebaseJson &add(T key, FirebaseJsonArray &value)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         dataHandler(getStr(key, addr), value, fb_json_func_type_add);
         delAddr(addr);
         return *this;
     }
 
+    template <typename T>
+    FirebaseJson &add(T key, FirebaseJsonArray &&value)
+    {
+        uintptr_t addr = 0;
+        nodeHandler(getStr(key, addr), value.takeRoot(), fb_json_func_type_add);
+        delAddr(addr);
+        return *this;
+    }
+
     /**
      * Get the FirebaseJson object serialized string.
      *
      * @param out The writable object e.g. String, std::string, char array, Stream e.g ile, WiFi/Ethernet Client and LWMQTT, that accepts the returning string.
      * @param prettify The text indentation and new line serialization option.
+     * @note The Print object e.g. Serial, File and Client, receives the string in chunks of FIREBASE_JSON_PRINT_CHUNK_SIZE bytes.
      */
 
     template <typename T>
@@ -2422,6 +2613,8 @@ public:
 
     bool toString(Stream &out, bool prettify = false) { return toStringHandler(out, prettify); }
 
+    bool toString(Print &out, bool prettify = false) { return writeStream(out, prettify); }
+
     bool toString(String &out, bool prettify = false) { return toStringHandler(out, prettify); }
 
     bool toString(MB_String &out, bool prettify = false) { return toStringHandler(out, prettify); }
@@ -2433,6 +2626,51 @@ public:
     }
 #endif
 
+    /**
+     * Serialize the FirebaseJson object to CBOR (RFC 8949) binary data.
+     *
+     * @param out The Print object e.g. File, WiFi/Ethernet Client and Serial, or the vector of bytes that accepts the encoded data.
+     * @return boolean status of the operation.
+     *
+     * @note The binary is smaller and faster to deserialize than the JSON string when keeping the data in flash
+     * or passing it between tasks.
+     */
+    bool toCBOR(Print &out) { return mToCBOR(&out, NULL); }
+
+    bool toCBOR(MB_VECTOR<uint8_t> &out) { return mToCBOR(NULL, &out); }
+
+    /**
+     * Deserialize the CBOR (RFC 8949) binary data as FirebaseJson object.
+     *
+     * @param data The CBOR data buffer, vector of bytes or Stream object e.g. File and WiFi/Ethernet Client to read.
+     * @param len The length of data buffer.
+     * @return boolean status of the operation.
+     *
+     * @note The top level item should be the map, byte strings and indefinite length text strings are not supported.
+     */
+    bool fromCBOR(const uint8_t *data, size_t len) { return mFromCBOR(data, len, NULL, false); }
+
+    bool fromCBOR(MB_VECTOR<uint8_t> &data) { return data.size() > 0 && mFromCBOR(&data[0], data.size(), NULL, false); }
+
+    bool fromCBOR(Stream &in) { return mFromCBOR(NULL, 0, &in, false); }
+
+    /**
+     * Get the changes of FirebaseJson object from its previous data.
+     *
+     * @param prev The FirebaseJson object of the previous data.
+     * @param result The FirebaseJson object that holds the changed nodes with their relative paths as the keys
+     * e.g. {"a/b/c":1,"d/0":"x","e":null}.
+     * @return boolean status of the operation.
+     *
+     * @note Only the changed leaf nodes, the added nodes and the removed nodes (as null) are kept in result,
+     * which can be used as the multi-location update data e.g. Database updateNode.
+     * The array elements are compared by their indexes.
+     * When the root type was changed (array and object), the result replaces the whole content, all current
+     * members are set and the previous members that no longer exist are null.
+     * The '~' and '/' in the keys are escaped as "~0" and "~1" (RFC 6901).
+     */
+    bool diff(FirebaseJson &prev, FirebaseJson &result) { return mDiff(prev, result); }
+
     /**
      * Get the value from the specified node path in FirebaseJson object.
      *
@@ -2465,7 +2703,7 @@ public:
     template <typename T>
     bool get(FirebaseJsonData &result, T path, bool prettify = false)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = mGet(root, &result, getStr(path, addr), prettify);
         delAddr(addr);
         return ret;
@@ -2480,7 +2718,7 @@ public:
     template <typename T>
     bool isMember(T path)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = mGet(root, NULL, getStr(path, addr));
         delAddr(addr);
         return ret;
@@ -2535,7 +2773,7 @@ public:
     template <typename T>
     void set(T key)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         mSet(getStr(key, addr), NULL);
         delAddr(addr);
     }
@@ -2556,7 +2794,7 @@ public:
     template <typename T1, typename T2>
     FirebaseJson &set(T1 key, T2 value)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         dataHandler(getStr(key, addr), value, fb_json_func_type_set);
         delAddr(addr);
         return *this;
@@ -2565,21 +2803,39 @@ public:
     template <typename T>
     FirebaseJson &set(T key, FirebaseJson &value)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         dataHandler(getStr(key, addr), value, fb_json_func_type_set);
         delAddr(addr);
         return *this;
     }
 
+    template <typename T>
+    FirebaseJson &set(T key, FirebaseJson &&value)
+    {
+        uintptr_t addr = 0;
+        nodeHandler(getStr(key, addr), value.takeRoot(), fb_json_func_type_set);
+        delAddr(addr);
+        return *this;
+    }
+
     template <typename T>
     FirebaseJson &set(T key, FirebaseJsonArray &value)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         dataHandler(getStr(key, addr), value, fb_json_func_type_set);
         delAddr(addr);
         return *this;
     }
 
+    template <typename T>
+    FirebaseJson &set(T key, FirebaseJsonArray &&value)
+    {
+        uintptr_t addr = 0;
+        nodeHandler(getStr(key, addr), value.takeRoot(), fb_json_func_type_set);
+        delAddr(addr);
+        return *this;
+    }
+
     /**
      * Remove the specified node and its content.
      *
@@ -2589,7 +2845,7 @@ public:
     template <typename T>
     bool remove(T path)
     {
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         bool ret = mRemove(getStr(path, addr));
         delAddr(addr);
         return ret;
@@ -2643,7 +2899,7 @@ private:
 
         root_type = Root_Type_JSON;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         if (type == fb_json_func_type_add)
             nAdd(getStr(arg1, addr), MB_JSON_CreateBool(arg2));
         else if (type == fb_json_func_type_set)
@@ -2660,7 +2916,7 @@ private:
 
         root_type = Root_Type_JSON;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         if (type == fb_json_func_type_add)
             nAdd(getStr(arg1, addr), MB_JSON_CreateRaw(num2Str(arg2, -1)));
         else if (type == fb_json_func_type_set)
@@ -2677,7 +2933,7 @@ private:
 
         root_type = Root_Type_JSON;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         if (type == fb_json_func_type_add)
             nAdd(getStr(arg1, addr), MB_JSON_CreateRaw(num2Str(arg2, floatDigits)));
         else if (type == fb_json_func_type_set)
@@ -2694,7 +2950,7 @@ private:
 
         root_type = Root_Type_JSON;
 
-        uint32_t addr = 0;
+        uintptr_t addr = 0;
         if (type == fb_json_func_type_add)
             nAdd(getStr(arg1, addr), MB_JSON_CreateRaw(num2Str(arg2, doubleDigits)));
         else if (type == fb_json_func_type_set)
@@ -2711,8 +2967,8 @@ private:
 
         root_type = Root_Type_JSON;
 
-        uint32_t addr1 = 0;
-        uint32_t addr2 = 0;
+        uintptr_t addr1 = 0;
+        uintptr_t addr2 = 0;
         if (type == fb_json_func_type_add)
             nAdd(getStr(arg1, addr1), MB_JSON_CreateString(getStr(arg2, addr2)));
         else if (type == fb_json_func_type_set)
@@ -2728,37 +2984,41 @@ private:
         if (root_type != Root_Type_JSON)
             mClear();
 
-        root_type = Root_Type_JSON;
-
-        MB_JSON *e = MB_JSON_Duplicate(json.root, true);
-        uint32_t addr = 0;
-        if (type == fb_json_func_type_add)
-            nAdd(getStr(arg, addr), e);
-        else if (type == fb_json_func_type_set)
-            mSet(getStr(arg, addr), e);
+        uintptr_t addr = 0;
+        nodeHandler(getStr(arg, addr), MB_JSON_Duplicate(json.root, true), type);
         delAddr(addr);
         return *this;
     }
 
     template <typename T>
     auto dataHandler(T arg, FirebaseJsonArray &arr, fb_json_func_type_t type) -> typename std::enable_if<is_string<T>::value, FirebaseJson &>::type
+    {
+        if (root_type != Root_Type_JSON)
+            mClear();
+
+        uintptr_t addr = 0;
+        nodeHandler(getStr(arg, addr), MB_JSON_Duplicate(arr.root, true), type);
+        delAddr(addr);
+        return *this;
+    }
+
+    FirebaseJson &nodeHandler(const char *key, MB_JSON *e, fb_json_func_type_t type)
     {
         if (root_type != Root_Type_JSON)
             mClear();
 
         root_type = Root_Type_JSON;
 
-        MB_JSON *e = MB_JSON_Duplicate(arr.root, true);
-        uint32_t addr = 0;
         if (type == fb_json_func_type_add)
-            nAdd(getStr(arg, addr), e);
+            nAdd(key, e);
         else if (type == fb_json_func_type_set)
-            mSet(getStr(arg, addr), e);
-        delAddr(addr);
+            mSet(key, e);
+        else
+            MB_JSON_Delete(e);
         return *this;
     }
 
-    void delAddr(uint32_t addr)
+    void delAddr(uintptr_t addr)
     {
         if (addr > 0)
         {
@@ -2769,4 +3029,8 @@ private:
     }
 };
 
+#include "FirebaseJsonBind.h"
+#include "FirebaseJsonReader.h"
+#include "FirebaseJsonQuery.h"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,1087 @@
+/*
+ * FirebaseJsonBind, version 1.0.0
+ *
+ * The compile-time binding between the C++ struct and JSON object for FirebaseJson library.
+ *
+ * Created October 19, 2026
+ *
+ * Features
+ * - The struct declares its fields once with FIREBASE_JSON_BIND and FIREBASE_JSON_FIELD macros.
+ * - Serializing straight to Print (Clients, File and Hardware Serial), String and MB_String without building
+ *   the MB_JSON tree.
+ * - Deserializing in a single pass over the JSON text without building the MB_JSON tree.
+ *
+ * The member types supported are bool, integer, float, double, MB_String, String, std::string, char array,
+ * other bound struct, fixed size array and std::vector of the supported types.
+ *
+ * e.g.
+ *
+ * struct Sensor
+ * {
+ *     int id;
+ *     float temp;
+ *     MB_String name;
+ *
+ *     FIREBASE_JSON_BIND(FIREBASE_JSON_FIELD(Sensor, id), FIREBASE_JSON_FIELD(Sensor, temp),
+ *                        FIREBASE_JSON_FIELD_KEY(Sensor, name, "sensor_name"))
+ * };
+ *
+ * Sensor sensor;
+ * fb_js_bind::toString(Serial, sensor); // {"id":0,"temp":0,"sensor_name":""}
+ * fb_js_bind::fromString(sensor, "{\"id\":1,\"temp\":25.5}");
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FirebaseJsonBind_H
+#define FirebaseJsonBind_H
+
+#include "FirebaseJson.h"
+
+// The size of the buffer that collects the serialized text before writing it to the output.
+#ifndef FIREBASE_JSON_BIND_BUFFER_SIZE
+#define FIREBASE_JSON_BIND_BUFFER_SIZE 128
+#endif
+
+#ifndef FIREBASE_JSON_BIND_FLOAT_DIGITS
+#define FIREBASE_JSON_BIND_FLOAT_DIGITS 5
+#endif
+
+#ifndef FIREBASE_JSON_BIND_DOUBLE_DIGITS
+#define FIREBASE_JSON_BIND_DOUBLE_DIGITS 9
+#endif
+
+/**
+ * The field descriptor of the struct member, its key is the member name.
+ */
+#define FIREBASE_JSON_FIELD(type, member) fb_js_bind::field(#member, &type::member)
+
+/**
+ * The field descriptor of the struct member with the key (string literal).
+ */
+#define FIREBASE_JSON_FIELD_KEY(type, member, key) fb_js_bind::field(key, &type::member)
+
+/**
+ * Declare the fields of the struct, place it inside the struct after its members.
+ */
+#define FIREBASE_JSON_BIND(...)                                                  \
+    static constexpr auto fbJsonFields() -> decltype(fb_js_bind::fields(__VA_ARGS__)) \
+    {                                                                            \
+        return fb_js_bind::fields(__VA_ARGS__);                                  \
+    }
+
+namespace fb_js_bind
+{
+    template <typename S, typename M>
+    struct field_t
+    {
+        const char *key;
+        size_t len;
+        M S::*member;
+    };
+
+    template <typename S, typename M, size_t N>
+    constexpr field_t<S, M> field(const char (&key)[N], M S::*member)
+    {
+        return field_t<S, M>{key, N - 1, member};
+    }
+
+    template <typename... F>
+    struct fields_t
+    {
+    };
+
+    template <typename F, typename... R>
+    struct fields_t<F, R...>
+    {
+        F first;
+        fields_t<R...> rest;
+        constexpr fields_t(F f, R... r) : first(f), rest(r...) {}
+    };
+
+    template <typename... F>
+    constexpr fields_t<F...> fields(F... f)
+    {
+        return fields_t<F...>(f...);
+    }
+
+    // The fields of the struct that declared with FIREBASE_JSON_BIND.
+    // Specialize it with the static fields() function to bind the struct that can't be modified.
+    template <typename T, typename = void>
+    struct binding
+    {
+    };
+
+    template <typename T>
+    struct binding<T, decltype(T::fbJsonFields(), void())>
+    {
+        static constexpr auto fields() -> decltype(T::fbJsonFields()) { return T::fbJsonFields(); }
+    };
+
+    template <typename T, typename = void>
+    struct is_bound
+    {
+        static bool const value = false;
+    };
+
+    template <typename T>
+    struct is_bound<T, decltype(binding<T>::fields(), void())>
+    {
+        static bool const value = true;
+    };
+
+    struct writer_t
+    {
+        Print *print = NULL;
+        MB_String *str = NULL;
+        size_t total = 0;
+        size_t pos = 0;
+        char buf[FIREBASE_JSON_BIND_BUFFER_SIZE + 1];
+
+        void write(const char *s, size_t n)
+        {
+            total += n;
+            while (n > 0)
+            {
+                size_t len = FIREBASE_JSON_BIND_BUFFER_SIZE - pos;
+                if (len > n)
+                    len = n;
+                memcpy(buf + pos, s, len);
+                pos += len;
+                s += len;
+                n -= len;
+                if (pos == FIREBASE_JSON_BIND_BUFFER_SIZE)
+                    flush();
+            }
+        }
+
+        void put(char c)
+        {
+            total++;
+            buf[pos++] = c;
+            if (pos == FIREBASE_JSON_BIND_BUFFER_SIZE)
+                flush();
+        }
+
+        void flush()
+        {
+            if (pos == 0)
+                return;
+            if (print)
+                print->write((const uint8_t *)buf, pos);
+            if (str)
+            {
+                buf[pos] = '\0';
+                str->append(buf, pos);
+            }
+            pos = 0;
+        }
+    };
+
+    struct reader_t
+    {
+        const char *p = NULL;
+        const char *end = NULL;
+        int depth = 0;
+    };
+
+    // The output of the unescaped string to the char array, the exceeded characters are dropped.
+    struct chars_t
+    {
+        char *buf;
+        size_t size;
+        size_t pos;
+
+        void write(const char *s, size_t n)
+        {
+            while (n-- > 0)
+                put(*s++);
+        }
+
+        void put(char c)
+        {
+            if (pos + 1 < size)
+                buf[pos++] = c;
+        }
+
+        void flush()
+        {
+            if (size > 0)
+                buf[pos] = '\0';
+        }
+    };
+
+    template <typename S>
+    auto writeObject(writer_t &w, const S &obj) -> typename mb_string::enable_if<is_bound<S>::value>::type;
+    template <typename S>
+    auto readObject(reader_t &r, S &obj) -> typename mb_string::enable_if<is_bound<S>::value, bool>::type;
+
+    inline void writeUInt(writer_t &w, unsigned long long v, bool neg)
+    {
+        char t[21];
+        int i = sizeof(t);
+
+        // avoid the 64-bit division on 32-bit devices whenever possible
+        if (v <= 0xffffffffUL)
+        {
+            uint32_t u = (uint32_t)v;
+            do
+            {
+                t[--i] = '0' + u % 10;
+                u /= 10;
+            } while (u);
+        }
+        else
+        {
+            do
+            {
+                t[--i] = '0' + v % 10;
+                v /= 10;
+            } while (v);
+        }
+
+        if (neg)
+            t[--i] = '-';
+
+        w.write(t + i, sizeof(t) - i);
+    }
+
+    inline void writeFloat(writer_t &w, double v, int digits)
+    {
+        if (isnan(v) || isinf(v))
+        {
+            w.write("null", 4);
+            return;
+        }
+
+        // the digits are the decimal places for the integer part and the significant digits
+        // for the fraction part, the small value e.g. 1e-12 is not rounded to zero
+        int prec = digits;
+        for (double a = v < 0 ? -v : v; a >= 1 && prec < 17; a /= 10)
+            prec++;
+
+        char t[32];
+        int len = snprintf(t, sizeof(t), "%.*g", prec, v);
+        if (len < 0 || len >= (int)sizeof(t))
+            len = snprintf(t, sizeof(t), "%.17g", v);
+
+        w.write(t, len);
+    }
+
+    inline void writeString(writer_t &w, const char *s, size_t n)
+    {
+        static const char hex[] = "0123456789abcdef";
+        size_t start = 0;
+
+        w.put('"');
+
+        for (size_t i = 0; i < n; i++)
+        {
+            unsigned char c = (unsigned char)s[i];
+            if (c >= 0x20 && c != '"' && c != '\\')
+                continue;
+
+            w.write(s + start, i - start);
+            start = i + 1;
+
+            char e[6] = {'\\', 0, 0, 0, 0, 0};
+            size_t len = 2;
+            switch (c)
+            {
+            case '"':
+            case '\\':
+                e[1] = c;
+                break;
+            case '\b':
+                e[1] = 'b';
+                break;
+            case '\f':
+                e[1] = 'f';
+                break;
+            case '\n':
+                e[1] = 'n';
+                break;
+            case '\r':
+                e[1] = 'r';
+                break;
+            case '\t':
+                e[1] = 't';
+                break;
+            default:
+                e[1] = 'u';
+                e[2] = '0';
+                e[3] = '0';
+                e[4] = hex[c >> 4];
+                e[5] = hex[c & 0xf];
+                len = 6;
+                break;
+            }
+            w.write(e, len);
+        }
+
+        w.write(s + start, n - start);
+        w.put('"');
+    }
+
+    inline void writeValue(writer_t &w, bool v)
+    {
+        if (v)
+            w.write("true", 4);
+        else
+            w.write("false", 5);
+    }
+
+    template <typename T>
+    auto writeValue(writer_t &w, const T &v) -> typename mb_string::enable_if<is_num_neg_int<T>::value>::type
+    {
+        if (v < 0)
+            writeUInt(w, 0ULL - (unsigned long long)v, true);
+        else
+            writeUInt(w, (unsigned long long)v, false);
+    }
+
+    template <typename T>
+    auto writeValue(writer_t &w, const T &v) -> typename mb_string::enable_if<is_num_pos_int<T>::value>::type
+    {
+        writeUInt(w, (unsigned long long)v, false);
+    }
+
+    inline void writeValue(writer_t &w, float v) { writeFloat(w, v, FIREBASE_JSON_BIND_FLOAT_DIGITS); }
+
+    inline void writeValue(writer_t &w, double v) { writeFloat(w, v, FIREBASE_JSON_BIND_DOUBLE_DIGITS); }
+
+    inline void writeValue(writer_t &w, const MB_String &v) { writeString(w, v.c_str(), v.length()); }
+
+    inline void writeValue(writer_t &w, const String &v) { writeString(w, v.c_str(), v.length()); }
+
+#if !defined(__AVR__)
+    inline void writeValue(writer_t &w, const std::string &v) { writeString(w, v.c_str(), v.length()); }
+#endif
+
+    inline void writeValue(writer_t &w, const char *v)
+    {
+        if (v)
+            writeString(w, v, strlen(v));
+        else
+            w.write("null", 4);
+    }
+
+    template <size_t N>
+    void writeValue(writer_t &w, const char (&v)[N])
+    {
+        size_t len = 0;
+        while (len < N && v[len])
+            len++;
+        writeString(w, v, len);
+    }
+
+    template <typename T>
+    auto writeValue(writer_t &w, const T &v) -> typename mb_string::enable_if<is_bound<T>::value>::type
+    {
+        writeObject(w, v);
+    }
+
+    template <typename T, size_t N>
+    void writeValue(writer_t &w, const T (&v)[N])
+    {
+        w.put('[');
+        for (size_t i = 0; i < N; i++)
+        {
+            if (i > 0)
+                w.put(',');
+            writeValue(w, v[i]);
+        }
+        w.put(']');
+    }
+
+#if !defined(__AVR__)
+    template <typename T>
+    void writeValue(writer_t &w, const std::vector<T> &v)
+    {
+        w.put('[');
+        for (size_t i = 0; i < v.size(); i++)
+        {
+            if (i > 0)
+                w.put(',');
+            writeValue(w, v[i]);
+        }
+        w.put(']');
+    }
+#endif
+
+    template <typename S>
+    void writeFields(writer_t &, const S &, const fields_t<> &, bool)
+    {
+    }
+
+    template <typename S, typename F, typename... R>
+    void writeFields(writer_t &w, const S &obj, const fields_t<F, R...> &f, bool first)
+    {
+        if (!first)
+            w.put(',');
+        writeString(w, f.first.key, f.first.len);
+        w.put(':');
+        writeValue(w, obj.*(f.first.member));
+        writeFields(w, obj, f.rest, false);
+    }
+
+    template <typename S>
+    auto writeObject(writer_t &w, const S &obj) -> typename mb_string::enable_if<is_bound<S>::value>::type
+    {
+        w.put('{');
+        writeFields(w, obj, binding<S>::fields(), true);
+        w.put('}');
+    }
+
+    inline void skipSpace(reader_t &r)
+    {
+        while (r.p < r.end && (*r.p == ' ' || *r.p == '\t' || *r.p == '\n' || *r.p == '\r'))
+            r.p++;
+    }
+
+    inline bool consume(reader_t &r, char c)
+    {
+        skipSpace(r);
+        if (r.p < r.end && *r.p == c)
+        {
+            r.p++;
+            return true;
+        }
+        return false;
+    }
+
+    inline bool peek(reader_t &r, char c)
+    {
+        skipSpace(r);
+        return r.p < r.end && *r.p == c;
+    }
+
+    inline bool literal(reader_t &r, const char *lit, size_t n)
+    {
+        skipSpace(r);
+        if ((size_t)(r.end - r.p) >= n && memcmp(r.p, lit, n) == 0)
+        {
+            r.p += n;
+            return true;
+        }
+        return false;
+    }
+
+    // Finds the raw (escaped) string content between the quotes.
+    inline bool scanString(reader_t &r, const char *&s, size_t &n, bool &escaped)
+    {
+        if (!consume(r, '"'))
+            return false;
+
+        s = r.p;
+        escaped = false;
+
+        while (r.p < r.end && *r.p != '"')
+        {
+            if ((unsigned char)*r.p < 0x20)
+                return false;
+            if (*r.p == '\\')
+            {
+                escaped = true;
+                r.p++;
+            }
+            r.p++;
+        }
+
+        if (r.p >= r.end)
+            return false;
+
+        n = r.p - s;
+        r.p++;
+        return true;
+    }
+
+    inline int hexValue(char c)
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return -1;
+    }
+
+    inline bool readHex4(const char *s, const char *end, uint32_t &cp)
+    {
+        if (end - s < 4)
+            return false;
+        cp = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            int v = hexValue(s[i]);
+            if (v < 0)
+                return false;
+            cp = (cp << 4) | v;
+        }
+        return true;
+    }
+
+    template <typename O>
+    bool unescape(const char *s, size_t n, O &out)
+    {
+        const char *end = s + n;
+        const char *start = s;
+
+        while (s < end)
+        {
+            if (*s != '\\')
+            {
+                s++;
+                continue;
+            }
+
+            out.write(start, s - start);
+            s++;
+            if (s >= end)
+                return false;
+
+            char c = *s++;
+            switch (c)
+            {
+            case 'b':
+                out.put('\b');
+                break;
+            case 'f':
+                out.put('\f');
+                break;
+            case 'n':
+                out.put('\n');
+                break;
+            case 'r':
+                out.put('\r');
+                break;
+            case 't':
+                out.put('\t');
+                break;
+            case 'u':
+            {
+                uint32_t cp = 0;
+                if (!readHex4(s, end, cp))
+                    return false;
+                s += 4;
+
+                if (cp >= 0xD800 && cp <= 0xDBFF)
+                {
+                    // surrogate pair
+                    uint32_t lo = 0;
+                    if (end - s < 6 || s[0] != '\\' || s[1] != 'u' || !readHex4(s + 2, end, lo) || lo < 0xDC00 || lo > 0xDFFF)
+                        return false;
+                    s += 6;
+                    cp = 0x10000 + (((cp & 0x3FF) << 10) | (lo & 0x3FF));
+                }
+                else if (cp >= 0xDC00 && cp <= 0xDFFF)
+                    return false;
+
+                char u[4];
+                size_t len = 0;
+                if (cp < 0x80)
+                    u[len++] = (char)cp;
+                else if (cp < 0x800)
+                {
+                    u[len++] = (char)(0xC0 | (cp >> 6));
+                    u[len++] = (char)(0x80 | (cp & 0x3F));
+                }
+                else if (cp < 0x10000)
+                {
+                    u[len++] = (char)(0xE0 | (cp >> 12));
+                    u[len++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                    u[len++] = (char)(0x80 | (cp & 0x3F));
+                }
+                else
+                {
+                    u[len++] = (char)(0xF0 | (cp >> 18));
+                    u[len++] = (char)(0x80 | ((cp >> 12) & 0x3F));
+                    u[len++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                    u[len++] = (char)(0x80 | (cp & 0x3F));
+                }
+                out.write(u, len);
+                break;
+            }
+            default:
+                out.put(c);
+                break;
+            }
+            start = s;
+        }
+
+        out.write(start, s - start);
+        out.flush();
+        return true;
+    }
+
+    inline bool skipValue(reader_t &r)
+    {
+        skipSpace(r);
+        if (r.p >= r.end)
+            return false;
+
+        const char *s = NULL;
+        size_t n = 0;
+        bool escaped = false;
+
+        switch (*r.p)
+        {
+        case '"':
+            return scanString(r, s, n, escaped);
+        case '{':
+        case '[':
+        {
+            char close = *r.p == '{' ? '}' : ']';
+            r.p++;
+            if (++r.depth > MB_JSON_NESTING_LIMIT)
+                return false;
+            if (!consume(r, close))
+            {
+                do
+                {
+                    if (close == '}' && (!scanString(r, s, n, escaped) || !consume(r, ':')))
+                        return false;
+                    if (!skipValue(r))
+                        return false;
+                } while (consume(r, ','));
+
+                if (!consume(r, close))
+                    return false;
+            }
+            r.depth--;
+            return true;
+        }
+        case 't':
+            return literal(r, "true", 4);
+        case 'f':
+            return literal(r, "false", 5);
+        case 'n':
+            return literal(r, "null", 4);
+        default:
+        {
+            MB_JSON_NumberInfo info;
+            n = MB_JSON_ScanNumber(r.p, r.end - r.p, &info);
+            r.p += n;
+            return n > 0;
+        }
+        }
+    }
+
+    // Scans the number value, the other value types are skipped and leave the member unchanged.
+    inline bool readNumber(reader_t &r, MB_JSON_NumberInfo &info, bool &found)
+    {
+        skipSpace(r);
+        found = false;
+        if (r.p < r.end && (*r.p == '-' || (*r.p >= '0' && *r.p <= '9')))
+        {
+            size_t n = MB_JSON_ScanNumber(r.p, r.end - r.p, &info);
+            r.p += n;
+            found = n > 0;
+            return found;
+        }
+        return skipValue(r);
+    }
+
+    inline bool readValue(reader_t &r, bool &v)
+    {
+        if (literal(r, "true", 4))
+            v = true;
+        else if (literal(r, "false", 5))
+            v = false;
+        else
+            return skipValue(r);
+        return true;
+    }
+
+    // Converts the number to integer type, the value that is out of range of the type is not converted.
+    template <typename T>
+    bool toInt(const MB_JSON_NumberInfo &info, T &v)
+    {
+        const bool sign = is_num_neg_int<T>::value;
+        const int bits = (int)sizeof(T) * 8 - (sign ? 1 : 0);
+        const unsigned long long max = ~0ULL >> (64 - bits);
+
+        if (info.type == MB_JSON_NumberFloat)
+        {
+            // the fraction is truncated, NaN fails both comparisons
+            double lim = ldexp(1.0, bits);
+            if (!(info.value < lim && (sign ? info.value >= -lim : info.value > -1.0)))
+                return false;
+            v = (T)info.value;
+        }
+        else if (info.negative && info.integer > 0)
+        {
+            if (!sign || info.integer - 1 > max)
+                return false;
+            v = (T)(-(long long)(info.integer - 1) - 1);
+        }
+        else
+        {
+            if (info.integer > max)
+                return false;
+            v = (T)info.integer;
+        }
+        return true;
+    }
+
+    template <typename T>
+    auto readValue(reader_t &r, T &v) -> typename mb_string::enable_if<is_num_int<T>::value, bool>::type
+    {
+        MB_JSON_NumberInfo info;
+        bool found = false;
+        if (!readNumber(r, info, found))
+            return false;
+        if (found)
+            toInt(info, v);
+        return true;
+    }
+
+    template <typename T>
+    auto readValue(reader_t &r, T &v) -> typename mb_string::enable_if<is_num_float<T>::value, bool>::type
+    {
+        MB_JSON_NumberInfo info;
+        bool found = false;
+        if (!readNumber(r, info, found))
+            return false;
+        if (found)
+            v = (T)info.value;
+        return true;
+    }
+
+    // Reads the string value into the MB_String, the other value types are skipped.
+    inline bool readString(reader_t &r, MB_String &v, bool &found)
+    {
+        found = false;
+        if (!peek(r, '"'))
+            return skipValue(r);
+
+        const char *s = NULL;
+        size_t n = 0;
+        bool escaped = false;
+        if (!scanString(r, s, n, escaped))
+            return false;
+
+        v.clear();
+        writer_t w;
+        w.str = &v;
+        if (escaped)
+        {
+            if (!unescape(s, n, w))
+                return false;
+        }
+        else
+        {
+            w.write(s, n);
+            w.flush();
+        }
+        found = true;
+        return true;
+    }
+
+    inline bool readValue(reader_t &r, MB_String &v)
+    {
+        bool found = false;
+        return readString(r, v, found);
+    }
+
+    inline bool readValue(reader_t &r, String &v)
+    {
+        MB_String t;
+        bool found = false;
+        if (!readString(r, t, found))
+            return false;
+        if (found)
+            v = t.c_str();
+        return true;
+    }
+
+#if !defined(__AVR__)
+    inline bool readValue(reader_t &r, std::string &v)
+    {
+        MB_String t;
+        bool found = false;
+        if (!readString(r, t, found))
+            return false;
+        if (found)
+            v.assign(t.c_str(), t.length());
+        return true;
+    }
+#endif
+
+    template <size_t N>
+    bool readValue(reader_t &r, char (&v)[N])
+    {
+        if (!peek(r, '"'))
+            return skipValue(r);
+
+        const char *s = NULL;
+        size_t n = 0;
+        bool escaped = false;
+        if (!scanString(r, s, n, escaped))
+            return false;
+
+        chars_t out = {v, N, 0};
+        if (escaped)
+            return unescape(s, n, out);
+
+        out.write(s, n);
+        out.flush();
+        return true;
+    }
+
+    template <typename T>
+    auto readValue(reader_t &r, T &v) -> typename mb_string::enable_if<is_bound<T>::value, bool>::type
+    {
+        if (!peek(r, '{'))
+            return skipValue(r);
+        return readObject(r, v);
+    }
+
+    template <typename T, size_t N>
+    bool readValue(reader_t &r, T (&v)[N])
+    {
+        if (!peek(r, '['))
+            return skipValue(r);
+
+        r.p++;
+        if (++r.depth > MB_JSON_NESTING_LIMIT)
+            return false;
+
+        if (!consume(r, ']'))
+        {
+            size_t i = 0;
+            do
+            {
+                // the elements exceed the array size are skipped
+                if (!(i < N ? readValue(r, v[i]) : skipValue(r)))
+                    return false;
+                i++;
+            } while (consume(r, ','));
+
+            if (!consume(r, ']'))
+                return false;
+        }
+        r.depth--;
+        return true;
+    }
+
+#if !defined(__AVR__)
+    template <typename T>
+    bool readValue(reader_t &r, std::vector<T> &v)
+    {
+        if (!peek(r, '['))
+            return skipValue(r);
+
+        r.p++;
+        if (++r.depth > MB_JSON_NESTING_LIMIT)
+            return false;
+
+        v.clear();
+        if (!consume(r, ']'))
+        {
+            do
+            {
+                T e = T();
+                if (!readValue(r, e))
+                    return false;
+                v.push_back(e);
+            } while (consume(r, ','));
+
+            if (!consume(r, ']'))
+                return false;
+        }
+        r.depth--;
+        return true;
+    }
+#endif
+
+    // Returns 1 when the value of the matched field was read, 0 when no field matched and -1 on error.
+    template <typename S>
+    int readField(reader_t &, S &, const fields_t<> &, const char *, size_t)
+    {
+        return 0;
+    }
+
+    template <typename S, typename F, typename... R>
+    int readField(reader_t &r, S &obj, const fields_t<F, R...> &f, const char *key, size_t len)
+    {
+        if (f.first.len == len && memcmp(f.first.key, key, len) == 0)
+            return readValue(r, obj.*(f.first.member)) ? 1 : -1;
+        return readField(r, obj, f.rest, key, len);
+    }
+
+    template <typename S>
+    auto readObject(reader_t &r, S &obj) -> typename mb_string::enable_if<is_bound<S>::value, bool>::type
+    {
+        if (!consume(r, '{'))
+            return false;
+
+        if (++r.depth > MB_JSON_NESTING_LIMIT)
+            return false;
+
+        if (!consume(r, '}'))
+        {
+            do
+            {
+                const char *key = NULL;
+                size_t len = 0;
+                bool escaped = false;
+                if (!scanString(r, key, len, escaped) || !consume(r, ':'))
+                    return false;
+
+                MB_String k;
+                if (escaped)
+                {
+                    writer_t w;
+                    w.str = &k;
+                    if (!unescape(key, len, w))
+                        return false;
+                    key = k.c_str();
+                    len = k.length();
+                }
+
+                int ret = readField(r, obj, binding<S>::fields(), key, len);
+                if (ret < 0 || (ret == 0 && !skipValue(r)))
+                    return false;
+
+            } while (consume(r, ','));
+
+            if (!consume(r, '}'))
+                return false;
+        }
+
+        r.depth--;
+        return true;
+    }
+
+    /**
+     * Serialize the bound struct as JSON object to the Print object e.g. Clients, File and Hardware Serial.
+     *
+     * @param out The Print object.
+     * @param obj The struct object.
+     * @return The number of bytes written.
+     */
+    template <typename S>
+    auto toString(Print &out, const S &obj) -> typename mb_string::enable_if<is_bound<S>::value, size_t>::type
+    {
+        writer_t w;
+        w.print = &out;
+        writeObject(w, obj);
+        w.flush();
+        return w.total;
+    }
+
+    /**
+     * Serialize the bound struct as JSON object to the MB_String.
+     *
+     * @param out The MB_String object to keep the JSON string.
+     * @param obj The struct object.
+     * @return The length of JSON string.
+     */
+    template <typename S>
+    auto toString(MB_String &out, const S &obj) -> typename mb_string::enable_if<is_bound<S>::value, size_t>::type
+    {
+        out.clear();
+        writer_t w;
+        w.str = &out;
+        writeObject(w, obj);
+        w.flush();
+        return w.total;
+    }
+
+    /**
+     * Serialize the bound struct as JSON object to the String.
+     *
+     * @param out The String object to keep the JSON string.
+     * @param obj The struct object.
+     * @return The length of JSON string.
+     */
+    template <typename S>
+    auto toString(String &out, const S &obj) -> typename mb_string::enable_if<is_bound<S>::value, size_t>::type
+    {
+        MB_String t;
+        size_t len = toString(t, obj);
+        out = t.c_str();
+        return len;
+    }
+
+    /**
+     * Get the length of serialized JSON string of the bound struct without writing it.
+     *
+     * @param obj The struct object.
+     * @return The length of JSON string.
+     */
+    template <typename S>
+    auto length(const S &obj) -> typename mb_string::enable_if<is_bound<S>::value, size_t>::type
+    {
+        writer_t w;
+        writeObject(w, obj);
+        return w.total;
+    }
+
+    /**
+     * Deserialize the JSON object string to the bound struct.
+     * The members that are not in the JSON object, have the mismatched value type or the number that is out of
+     * range of the member type, are left unchanged
+     * and the unknown keys are skipped.
+     *
+     * @param obj The struct object.
+     * @param json The JSON object string.
+     * @param len The length of JSON string.
+     * @return Boolean value, indicates the success of the operation.
+     */
+    template <typename S>
+    auto fromString(S &obj, const char *json, size_t len) -> typename mb_string::enable_if<is_bound<S>::value, bool>::type
+    {
+        if (!json)
+            return false;
+
+        reader_t r;
+        r.p = json;
+        r.end = json + len;
+        if (!readObject(r, obj))
+            return false;
+        skipSpace(r);
+        return r.p == r.end;
+    }
+
+    template <typename S>
+    auto fromString(S &obj, const char *json) -> typename mb_string::enable_if<is_bound<S>::value, bool>::type
+    {
+        return json ? fromString(obj, json, strlen(json)) : false;
+    }
+
+    template <typename S>
+    auto fromString(S &obj, const MB_String &json) -> typename mb_string::enable_if<is_bound<S>::value, bool>::type
+    {
+        return fromString(obj, json.c_str(), json.length());
+    }
+
+    template <typename S>
+    auto fromString(S &obj, const String &json) -> typename mb_string::enable_if<is_bound<S>::value, bool>::type
+    {
+        return fromString(obj, json.c_str(), json.length());
+    }
+}
+
+#endif
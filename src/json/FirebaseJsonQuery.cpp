@@ -0,0 +1,610 @@
+/*
+ * FirebaseJsonQuery, version 1.0.0
+ *
+ * The compiled JSONPath subset query for FirebaseJson library.
+ *
+ * Created October 19, 2026
+ *
+ * Features
+ * - The expression is compiled once and evaluated in a single traversal of FirebaseJson or FirebaseJsonArray object.
+ * - Evaluating over FirebaseJsonReader while the data is read from Stream, only the matched values are kept in the memory.
+ *
+ * The supported syntax
+ * $                 The root (optional).
+ * .name, ['name']   The object member.
+ * .*, [*]           All members of object or all elements of array.
+ * [n]               The array element, the negative index counts from the end.
+ * [start:end:step]  The array slice, start and end are optional and step is positive.
+ * [?(@.a.b op v)]   The members or elements that pass the filter, op is ==, !=, <, <=, > or >=, and v is the number,
+ *                   the quoted string, true, false or null. [?(@.a)] tests the existence and [?(@ op v)] tests the value itself.
+ *
+ * e.g.
+ *
+ * FirebaseJsonQuery query;
+ * FirebaseJsonArray result;
+ * query.compile("$.sensors[?(@.temp > 30)].name");
+ * query.select(json, result);
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FirebaseJsonQuery_CPP
+#define FirebaseJsonQuery_CPP
+
+#include "FirebaseJsonQuery.h"
+#include "FirebaseJsonReader.h"
+
+bool FirebaseJsonQuery::fail(const char *expression, const char *p)
+{
+    steps.clear();
+    compiled = false;
+    errorPos = expression && p ? (int)(p - expression) : 0;
+    return false;
+}
+
+bool FirebaseJsonQuery::parseInt(const char *&p, int &value)
+{
+    const char *s = p;
+    bool negative = *s == '-';
+    if (negative)
+        s++;
+
+    if (*s < '0' || *s > '9')
+        return false;
+
+    value = 0;
+    while (*s >= '0' && *s <= '9')
+        value = value * 10 + (*s++ - '0');
+
+    if (negative)
+        value = -value;
+    p = s;
+    return true;
+}
+
+bool FirebaseJsonQuery::parseName(const char *&p, MB_String &name)
+{
+    const char *s = p;
+    while (*s && !strchr(".[]()=!<> ", *s))
+        s++;
+
+    if (s == p)
+        return false;
+
+    name.clear();
+    name.append(p, s - p);
+    p = s;
+    return true;
+}
+
+bool FirebaseJsonQuery::parseQuoted(const char *&p, MB_String &str)
+{
+    char quote = *p;
+    const char *s = p + 1;
+    str.clear();
+
+    while (*s && *s != quote)
+    {
+        if (*s == '\\' && *(s + 1))
+            s++;
+        str += *s++;
+    }
+
+    if (*s != quote)
+        return false;
+
+    p = s + 1;
+    return true;
+}
+
+static void fb_js_query_skip_space(const char *&p)
+{
+    while (*p == ' ')
+        p++;
+}
+
+bool FirebaseJsonQuery::parseFilter(const char *&p, fb_js_query_step_t &step)
+{
+    fb_js_query_skip_space(p);
+    if (*p != '@')
+        return false;
+    p++;
+
+    while (*p == '.')
+    {
+        p++;
+        MB_String name;
+        if (!parseName(p, name))
+            return false;
+        step.field.push_back(name);
+    }
+
+    fb_js_query_skip_space(p);
+    if (*p == ')')
+        return true;
+
+    if (strncmp(p, "==", 2) == 0)
+        step.op = fb_js_query_op_eq;
+    else if (strncmp(p, "!=", 2) == 0)
+        step.op = fb_js_query_op_ne;
+    else if (strncmp(p, "<=", 2) == 0)
+        step.op = fb_js_query_op_le;
+    else if (strncmp(p, ">=", 2) == 0)
+        step.op = fb_js_query_op_ge;
+    else if (*p == '<')
+        step.op = fb_js_query_op_lt;
+    else if (*p == '>')
+        step.op = fb_js_query_op_gt;
+    else
+        return false;
+
+    p += (step.op == fb_js_query_op_lt || step.op == fb_js_query_op_gt) ? 1 : 2;
+    fb_js_query_skip_space(p);
+
+    MB_JSON_NumberInfo info;
+    size_t len = 0;
+
+    if (*p == '\'' || *p == '"')
+    {
+        step.literalType = MB_JSON_String;
+        if (!parseQuoted(p, step.str))
+            return false;
+    }
+    else if (strncmp(p, "true", 4) == 0 || strncmp(p, "false", 5) == 0)
+    {
+        step.literalType = *p == 't' ? MB_JSON_True : MB_JSON_False;
+        p += *p == 't' ? 4 : 5;
+    }
+    else if (strncmp(p, "null", 4) == 0)
+    {
+        step.literalType = MB_JSON_NULL;
+        p += 4;
+    }
+    else if ((len = MB_JSON_ScanNumber(p, strlen(p), &info)) > 0)
+    {
+        step.literalType = MB_JSON_Number;
+        step.num = info.value;
+        p += len;
+    }
+    else
+        return false;
+
+    // only the numbers and strings are ordered
+    if (step.op != fb_js_query_op_eq && step.op != fb_js_query_op_ne && step.literalType != MB_JSON_Number && step.literalType != MB_JSON_String)
+        return false;
+
+    fb_js_query_skip_space(p);
+    return true;
+}
+
+bool FirebaseJsonQuery::parseBracket(const char *&p, fb_js_query_step_t &step)
+{
+    fb_js_query_skip_space(p);
+
+    if (*p == '*')
+    {
+        step.type = fb_js_query_step_wildcard;
+        p++;
+    }
+    else if (*p == '\'' || *p == '"')
+    {
+        step.type = fb_js_query_step_key;
+        if (!parseQuoted(p, step.key))
+            return false;
+    }
+    else if (*p == '?')
+    {
+        step.type = fb_js_query_step_filter;
+        p++;
+        if (*p != '(')
+            return false;
+        p++;
+        if (!parseFilter(p, step) || *p != ')')
+            return false;
+        p++;
+    }
+    else
+    {
+        step.hasStart = parseInt(p, step.start);
+        if (*p == ':')
+        {
+            step.type = fb_js_query_step_slice;
+            p++;
+            step.hasEnd = parseInt(p, step.end);
+            if (*p == ':')
+            {
+                p++;
+                if (!parseInt(p, step.step) || step.step <= 0)
+                    return false;
+            }
+        }
+        else if (step.hasStart)
+            step.type = fb_js_query_step_index;
+        else
+            return false;
+    }
+
+    fb_js_query_skip_space(p);
+    return true;
+}
+
+bool FirebaseJsonQuery::compile(const char *expression)
+{
+    steps.clear();
+    errorPos = -1;
+    compiled = false;
+
+    if (!expression)
+        return fail(expression, expression);
+
+    const char *p = expression;
+    if (*p == '$')
+        p++;
+
+    while (*p)
+    {
+        fb_js_query_step_t step;
+
+        if (*p == '.')
+        {
+            p++;
+            if (*p == '*')
+            {
+                step.type = fb_js_query_step_wildcard;
+                p++;
+            }
+            else if (!parseName(p, step.key))
+                return fail(expression, p);
+        }
+        else if (*p == '[')
+        {
+            p++;
+            if (!parseBracket(p, step) || *p != ']')
+                return fail(expression, p);
+            p++;
+        }
+        else if (p == expression)
+        {
+            // the first member name without $.
+            if (!parseName(p, step.key))
+                return fail(expression, p);
+        }
+        else
+            return fail(expression, p);
+
+        steps.push_back(step);
+    }
+
+    compiled = true;
+    return true;
+}
+
+bool FirebaseJsonQuery::inSlice(const fb_js_query_step_t &step, int index, int size)
+{
+    int start = step.hasStart ? step.start : 0;
+    int end = step.end;
+
+    // size is -1 when it is not known
+    if (start < 0)
+    {
+        if (size < 0)
+            return false;
+        start = start + size < 0 ? 0 : start + size;
+    }
+
+    if (step.hasEnd && end < 0)
+    {
+        if (size < 0)
+            return false;
+        end += size;
+    }
+
+    return index >= start && (!step.hasEnd || index < end) && (index - start) % step.step == 0;
+}
+
+bool FirebaseJsonQuery::test(const fb_js_query_step_t &step, MB_JSON *e)
+{
+    for (size_t i = 0; i < step.field.size(); i++)
+    {
+        e = MB_JSON_IsObject(e) ? MB_JSON_GetObjectItemCaseSensitive(e, step.field[i].c_str()) : NULL;
+        if (!e)
+            return false;
+    }
+
+    if (step.op == fb_js_query_op_exists)
+        return true;
+
+    bool comparable = false;
+    int cmp = 0;
+
+    if (step.literalType == MB_JSON_Number)
+    {
+        double value = 0;
+        MB_JSON_NumberInfo info;
+
+        if (MB_JSON_IsNumber(e))
+        {
+            value = e->valuedouble;
+            comparable = true;
+        }
+        else if (MB_JSON_IsRaw(e) && e->valuestring && MB_JSON_ScanNumber(e->valuestring, strlen(e->valuestring), &info) == strlen(e->valuestring))
+        {
+            // the number that was added to FirebaseJson
+            value = info.value;
+            comparable = true;
+        }
+
+        cmp = value < step.num ? -1 : (value > step.num ? 1 : 0);
+    }
+    else if (step.literalType == MB_JSON_String)
+    {
+        comparable = MB_JSON_IsString(e) && e->valuestring;
+        if (comparable)
+            cmp = strcmp(e->valuestring, step.str.c_str());
+    }
+    else if (step.literalType == MB_JSON_NULL)
+        comparable = MB_JSON_IsNull(e);
+    else
+    {
+        comparable = MB_JSON_IsBool(e);
+        cmp = MB_JSON_IsTrue(e) == (step.literalType == MB_JSON_True) ? 0 : 1;
+    }
+
+    if (!comparable)
+        return step.op == fb_js_query_op_ne;
+
+    switch (step.op)
+    {
+    case fb_js_query_op_eq:
+        return cmp == 0;
+    case fb_js_query_op_ne:
+        return cmp != 0;
+    case fb_js_query_op_lt:
+        return cmp < 0;
+    case fb_js_query_op_le:
+        return cmp <= 0;
+    case fb_js_query_op_gt:
+        return cmp > 0;
+    case fb_js_query_op_ge:
+        return cmp >= 0;
+    default:
+        return false;
+    }
+}
+
+void FirebaseJsonQuery::evaluate(MB_JSON *e, size_t i, MB_VECTOR<MB_JSON *> &matches)
+{
+    if (!e)
+        return;
+
+    if (i == steps.size())
+    {
+        matches.push_back(e);
+        return;
+    }
+
+    const fb_js_query_step_t &step = steps[i];
+    MB_JSON *child = NULL;
+    int index = 0;
+
+    switch (step.type)
+    {
+    case fb_js_query_step_key:
+        if (MB_JSON_IsObject(e))
+            evaluate(MB_JSON_GetObjectItemCaseSensitive(e, step.key.c_str()), i + 1, matches);
+        break;
+
+    case fb_js_query_step_index:
+        if (MB_JSON_IsArray(e))
+        {
+            index = step.start < 0 ? step.start + MB_JSON_GetArraySize(e) : step.start;
+            if (index >= 0)
+                evaluate(MB_JSON_GetArrayItem(e, index), i + 1, matches);
+        }
+        break;
+
+    case fb_js_query_step_slice:
+        if (MB_JSON_IsArray(e))
+        {
+            int size = MB_JSON_GetArraySize(e);
+            for (child = e->child; child != NULL; child = child->next, index++)
+            {
+                if (inSlice(step, index, size))
+                    evaluate(child, i + 1, matches);
+            }
+        }
+        break;
+
+    case fb_js_query_step_wildcard:
+    case fb_js_query_step_filter:
+        if (MB_JSON_IsObject(e) || MB_JSON_IsArray(e))
+        {
+            for (child = e->child; child != NULL; child = child->next)
+            {
+                if (step.type == fb_js_query_step_wildcard || test(step, child))
+                    evaluate(child, i + 1, matches);
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+size_t FirebaseJsonQuery::select(FirebaseJsonBase &json, FirebaseJsonArray &result)
+{
+    MB_VECTOR<MB_JSON *> matches;
+
+    if (compiled)
+        evaluate(json.root, 0, matches);
+
+    // copy first, the result may be the queried object
+    for (size_t i = 0; i < matches.size(); i++)
+        matches[i] = MB_JSON_Duplicate(matches[i], true);
+
+    result.clear();
+
+    for (size_t i = 0; i < matches.size(); i++)
+        addResult(result, matches[i]);
+
+    return matches.size();
+}
+
+MB_JSON *FirebaseJsonQuery::take(FirebaseJsonReader &reader)
+{
+    switch (reader.type())
+    {
+    case fb_json_token_object_begin:
+    {
+        FirebaseJson json;
+        return reader.get(json) ? json.takeRoot() : NULL;
+    }
+    case fb_json_token_array_begin:
+    {
+        FirebaseJsonArray arr;
+        return reader.get(arr) ? arr.takeRoot() : NULL;
+    }
+    case fb_json_token_string:
+        return MB_JSON_CreateString(reader.value());
+    case fb_json_token_number:
+        return MB_JSON_CreateRaw(reader.value());
+    case fb_json_token_boolean:
+        return MB_JSON_CreateBool(reader.boolValue());
+    case fb_json_token_null:
+        return MB_JSON_CreateNull();
+    default:
+        return NULL;
+    }
+}
+
+void FirebaseJsonQuery::addResult(FirebaseJsonArray &result, MB_JSON *e)
+{
+    if (e)
+        result.nAdd(e);
+}
+
+bool FirebaseJsonQuery::walk(FirebaseJsonReader &reader, size_t i, FirebaseJsonArray &result, size_t &count)
+{
+    const fb_js_query_step_t &step = steps[i];
+    bool last = i + 1 == steps.size();
+    bool object = reader.type() == fb_json_token_object_begin;
+
+    while (true)
+    {
+        fb_json_token_type t = reader.next();
+
+        if (t == fb_json_token_object_end || t == fb_json_token_array_end)
+            return true;
+
+        if (t == fb_json_token_end || t == fb_json_token_error)
+            return false;
+
+        bool container = t == fb_json_token_object_begin || t == fb_json_token_array_begin;
+        bool hit = false;
+
+        switch (step.type)
+        {
+        case fb_js_query_step_key:
+            hit = object && strcmp(reader.key(), step.key.c_str()) == 0;
+            break;
+        case fb_js_query_step_index:
+            hit = !object && reader.index() == step.start;
+            break;
+        case fb_js_query_step_slice:
+            hit = !object && inSlice(step, reader.index(), -1);
+            break;
+        case fb_js_query_step_wildcard:
+            hit = true;
+            break;
+        case fb_js_query_step_filter:
+        {
+            // the filter tests inside the value, build it and continue on the tree
+            MB_JSON *e = take(reader);
+            if (!e)
+                return false;
+
+            if (test(step, e))
+            {
+                MB_VECTOR<MB_JSON *> matches;
+                evaluate(e, i + 1, matches);
+                for (size_t j = 0; j < matches.size(); j++)
+                {
+                    addResult(result, matches[j] == e ? e : MB_JSON_Duplicate(matches[j], true));
+                    if (matches[j] == e)
+                        e = NULL;
+                    count++;
+                }
+            }
+
+            if (e)
+                MB_JSON_Delete(e);
+            continue;
+        }
+        default:
+            break;
+        }
+
+        if (hit && last)
+        {
+            MB_JSON *e = take(reader);
+            if (!e)
+                return false;
+            addResult(result, e);
+            count++;
+        }
+        else if (hit && container)
+        {
+            if (!walk(reader, i + 1, result, count))
+                return false;
+        }
+        else if (container && !reader.skip())
+            return false;
+    }
+}
+
+size_t FirebaseJsonQuery::select(FirebaseJsonReader &reader, FirebaseJsonArray &result)
+{
+    size_t count = 0;
+    result.clear();
+
+    if (!compiled)
+        return 0;
+
+    fb_json_token_type t = reader.type();
+    if (t == fb_json_token_undefined)
+        t = reader.next();
+
+    if (steps.size() == 0)
+    {
+        MB_JSON *e = take(reader);
+        addResult(result, e);
+        return e ? 1 : 0;
+    }
+
+    if (t == fb_json_token_object_begin || t == fb_json_token_array_begin)
+        walk(reader, 0, result, count);
+
+    return count;
+}
+
+#endif
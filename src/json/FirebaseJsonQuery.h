@@ -0,0 +1,156 @@
+/*
+ * FirebaseJsonQuery, version 1.0.0
+ *
+ * The compiled JSONPath subset query for FirebaseJson library.
+ *
+ * Created October 19, 2026
+ *
+ * Features
+ * - The expression is compiled once and evaluated in a single traversal of FirebaseJson or FirebaseJsonArray object.
+ * - Evaluating over FirebaseJsonReader while the data is read from Stream, only the matched values are kept in the memory.
+ *
+ * The supported syntax
+ * $                 The root (optional).
+ * .name, ['name']   The object member.
+ * .*, [*]           All members of object or all elements of array.
+ * [n]               The array element, the negative index counts from the end.
+ * [start:end:step]  The array slice, start and end are optional and step is positive.
+ * [?(@.a.b op v)]   The members or elements that pass the filter, op is ==, !=, <, <=, > or >=, and v is the number,
+ *                   the quoted string, true, false or null. [?(@.a)] tests the existence and [?(@ op v)] tests the value itself.
+ *
+ * e.g.
+ *
+ * FirebaseJsonQuery query;
+ * FirebaseJsonArray result;
+ * query.compile("$.sensors[?(@.temp > 30)].name");
+ * query.select(json, result);
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FirebaseJsonQuery_H
+#define FirebaseJsonQuery_H
+
+#include "FirebaseJson.h"
+
+class FirebaseJsonReader;
+
+class FirebaseJsonQuery
+{
+public:
+    FirebaseJsonQuery() {}
+
+    FirebaseJsonQuery(const char *expression) { compile(expression); }
+
+    /**
+     * Compile the JSONPath expression.
+     *
+     * @param expression The JSONPath expression e.g. "$.logs[*].ts".
+     * @return The boolean status of the operation.
+     *
+     * @note Call errorPosition to get the position of the syntax error.
+     */
+    bool compile(const char *expression);
+
+    /**
+     * Select the values that match the compiled expression.
+     *
+     * @param json The FirebaseJson or FirebaseJsonArray object to query.
+     * @param result The FirebaseJsonArray object that receives the copies of the matched values.
+     * @return The count of the matched values.
+     */
+    size_t select(FirebaseJsonBase &json, FirebaseJsonArray &result);
+
+    /**
+     * Select the values that match the compiled expression while reading the JSON from Stream.
+     *
+     * @param reader The FirebaseJsonReader object that begins at the value to query.
+     * @param result The FirebaseJsonArray object that receives the matched values.
+     * @return The count of the matched values.
+     *
+     * @note Only the matched values and the members or elements tested by the filters are built, the others are skipped.
+     * The negative index and slice bounds never match because the array size is not known yet.
+     */
+    size_t select(FirebaseJsonReader &reader, FirebaseJsonArray &result);
+
+    /**
+     * Get the position of the syntax error in the expression, or -1.
+     */
+    int errorPosition() { return errorPos; }
+
+private:
+    typedef enum
+    {
+        fb_js_query_step_key,
+        fb_js_query_step_index,
+        fb_js_query_step_wildcard,
+        fb_js_query_step_slice,
+        fb_js_query_step_filter
+    } fb_js_query_step_type;
+
+    typedef enum
+    {
+        fb_js_query_op_exists,
+        fb_js_query_op_eq,
+        fb_js_query_op_ne,
+        fb_js_query_op_lt,
+        fb_js_query_op_le,
+        fb_js_query_op_gt,
+        fb_js_query_op_ge
+    } fb_js_query_op;
+
+    struct fb_js_query_step_t
+    {
+        fb_js_query_step_type type = fb_js_query_step_key;
+        MB_String key;
+        int start = 0;
+        int end = 0;
+        int step = 1;
+        bool hasStart = false;
+        bool hasEnd = false;
+        // filter
+        MB_VECTOR<MB_String> field;
+        fb_js_query_op op = fb_js_query_op_exists;
+        int literalType = MB_JSON_Invalid;
+        MB_String str;
+        double num = 0;
+    };
+
+    MB_VECTOR<fb_js_query_step_t> steps;
+    int errorPos = -1;
+    bool compiled = false;
+
+    bool fail(const char *expression, const char *p);
+    bool parseInt(const char *&p, int &value);
+    bool parseName(const char *&p, MB_String &name);
+    bool parseQuoted(const char *&p, MB_String &str);
+    bool parseFilter(const char *&p, fb_js_query_step_t &step);
+    bool parseBracket(const char *&p, fb_js_query_step_t &step);
+    bool test(const fb_js_query_step_t &step, MB_JSON *e);
+    bool inSlice(const fb_js_query_step_t &step, int index, int size);
+    void evaluate(MB_JSON *e, size_t i, MB_VECTOR<MB_JSON *> &matches);
+    bool walk(FirebaseJsonReader &reader, size_t i, FirebaseJsonArray &result, size_t &count);
+    MB_JSON *take(FirebaseJsonReader &reader);
+    void addResult(FirebaseJsonArray &result, MB_JSON *e);
+};
+
+#endif
@@ -0,0 +1,504 @@
+/*
+ * FirebaseJsonReader, version 1.0.0
+ *
+ * The pull parser that reads the JSON incrementally from Stream for FirebaseJson library.
+ *
+ * Created October 19, 2026
+ *
+ * Features
+ * - Reading from any Stream e.g. File, Clients (WiFi, Ethernet, and GSM) and Hardware Serial in small blocks
+ *   without loading the whole input to the memory.
+ * - The nesting depth, the key and value buffers are bounded with FIREBASE_JSON_READER_MAX_DEPTH
+ *   and FIREBASE_JSON_READER_BUFFER_SIZE.
+ * - Finding the value at the relative path and building only that subtree as FirebaseJson or FirebaseJsonArray object.
+ *
+ * e.g.
+ *
+ * FirebaseJsonReader reader;
+ * reader.begin(file);
+ * if (reader.find("data/sensors/[2]/name") && reader.type() == fb_json_token_string)
+ *     Serial.println(reader.value());
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FirebaseJsonReader_CPP
+#define FirebaseJsonReader_CPP
+
+#include "FirebaseJsonReader.h"
+
+void FirebaseJsonReader::begin(Stream &stream, uint32_t timeoutMS)
+{
+    this->stream = &stream;
+    timeout = timeoutMS;
+    inLen = 0;
+    inPos = 0;
+    position = 0;
+    keyBuf[0] = '\0';
+    valueBuf[0] = '\0';
+    valueLen = 0;
+    token = fb_json_token_undefined;
+    level = 0;
+    tokenDepth = 0;
+    tokenIndex = -1;
+    started = false;
+    afterValue = false;
+    truncated = false;
+    error = false;
+    done = false;
+    capture = NULL;
+}
+
+int FirebaseJsonReader::readChar()
+{
+    if (!stream)
+        return -1;
+
+    if (inPos == inLen)
+    {
+        // keep the captured bytes before the block is reused
+        if (capture && inLen > captureFrom)
+            capture->append(in + captureFrom, inLen - captureFrom);
+        captureFrom = 0;
+
+        unsigned long ms = millis();
+        int available = 0;
+        while ((available = stream->available()) <= 0)
+        {
+            if (millis() - ms > timeout)
+                return -1;
+            delay(0);
+        }
+
+        inLen = stream->readBytes(in, (size_t)available < FIREBASE_JSON_READER_INPUT_SIZE ? (size_t)available : FIREBASE_JSON_READER_INPUT_SIZE);
+        inPos = 0;
+        in[inLen] = '\0';
+        if (inLen == 0)
+            return -1;
+    }
+
+    position++;
+    return (uint8_t)in[inPos++];
+}
+
+void FirebaseJsonReader::unreadChar()
+{
+    // the character is still in the current block
+    inPos--;
+    position--;
+}
+
+int FirebaseJsonReader::skipSpace()
+{
+    int c = readChar();
+    while (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+        c = readChar();
+    return c;
+}
+
+fb_json_token_type FirebaseJsonReader::fail()
+{
+    error = true;
+    token = fb_json_token_error;
+    return token;
+}
+
+fb_json_token_type FirebaseJsonReader::push(bool object)
+{
+    if (level == FIREBASE_JSON_READER_MAX_DEPTH)
+        return fail();
+
+    stack[level] = object;
+    counts[level] = 0;
+    level++;
+    afterValue = false;
+    token = object ? fb_json_token_object_begin : fb_json_token_array_begin;
+    return token;
+}
+
+fb_json_token_type FirebaseJsonReader::pop(int c)
+{
+    if (c != (stack[level - 1] ? '}' : ']'))
+        return fail();
+
+    level--;
+    tokenDepth = level;
+    afterValue = true;
+    token = stack[level] ? fb_json_token_object_end : fb_json_token_array_end;
+    return token;
+}
+
+static void fb_json_reader_put(char *out, size_t &len, bool &trunc, char c)
+{
+    if (len < FIREBASE_JSON_READER_BUFFER_SIZE)
+        out[len++] = c;
+    else
+        trunc = true;
+}
+
+bool FirebaseJsonReader::readHex(uint32_t &code)
+{
+    code = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        int c = readChar();
+        if (c >= '0' && c <= '9')
+            code = (code << 4) | (uint32_t)(c - '0');
+        else if (c >= 'a' && c <= 'f')
+            code = (code << 4) | (uint32_t)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F')
+            code = (code << 4) | (uint32_t)(c - 'A' + 10);
+        else
+            return false;
+    }
+    return true;
+}
+
+bool FirebaseJsonReader::readString(char *out, size_t &len)
+{
+    len = 0;
+    while (true)
+    {
+        int c = readChar();
+        if (c < 0x20)
+            return false;
+
+        if (c == '"')
+            break;
+
+        if (c != '\\')
+        {
+            fb_json_reader_put(out, len, truncated, (char)c);
+            continue;
+        }
+
+        c = readChar();
+        switch (c)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            break;
+        case 'b':
+            c = '\b';
+            break;
+        case 'f':
+            c = '\f';
+            break;
+        case 'n':
+            c = '\n';
+            break;
+        case 'r':
+            c = '\r';
+            break;
+        case 't':
+            c = '\t';
+            break;
+        case 'u':
+        {
+            uint32_t code = 0, low = 0;
+            if (!readHex(code))
+                return false;
+
+            if (code >= 0xD800 && code <= 0xDBFF)
+            {
+                // the surrogate pair
+                if (readChar() != '\\' || readChar() != 'u' || !readHex(low) || low < 0xDC00 || low > 0xDFFF)
+                    return false;
+                code = 0x10000 + (((code & 0x3FF) << 10) | (low & 0x3FF));
+            }
+            else if (code >= 0xDC00 && code <= 0xDFFF)
+                return false;
+
+            if (code < 0x80)
+                fb_json_reader_put(out, len, truncated, (char)code);
+            else if (code < 0x800)
+            {
+                fb_json_reader_put(out, len, truncated, (char)(0xC0 | (code >> 6)));
+                fb_json_reader_put(out, len, truncated, (char)(0x80 | (code & 0x3F)));
+            }
+            else if (code < 0x10000)
+            {
+                fb_json_reader_put(out, len, truncated, (char)(0xE0 | (code >> 12)));
+                fb_json_reader_put(out, len, truncated, (char)(0x80 | ((code >> 6) & 0x3F)));
+                fb_json_reader_put(out, len, truncated, (char)(0x80 | (code & 0x3F)));
+            }
+            else
+            {
+                fb_json_reader_put(out, len, truncated, (char)(0xF0 | (code >> 18)));
+                fb_json_reader_put(out, len, truncated, (char)(0x80 | ((code >> 12) & 0x3F)));
+                fb_json_reader_put(out, len, truncated, (char)(0x80 | ((code >> 6) & 0x3F)));
+                fb_json_reader_put(out, len, truncated, (char)(0x80 | (code & 0x3F)));
+            }
+            continue;
+        }
+        default:
+            return false;
+        }
+        fb_json_reader_put(out, len, truncated, (char)c);
+    }
+
+    out[len] = '\0';
+    return true;
+}
+
+bool FirebaseJsonReader::readValue(int c)
+{
+    valueLen = 0;
+
+    if (c == '"')
+    {
+        token = fb_json_token_string;
+        return readString(valueBuf, valueLen);
+    }
+
+    if (c == '-' || (c >= '0' && c <= '9'))
+    {
+        while (c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E' || (c >= '0' && c <= '9'))
+        {
+            fb_json_reader_put(valueBuf, valueLen, truncated, (char)c);
+            c = readChar();
+        }
+
+        // the number ends at the next character or at the end of input
+        if (c >= 0)
+            unreadChar();
+
+        valueBuf[valueLen] = '\0';
+        token = fb_json_token_number;
+        MB_JSON_NumberInfo info;
+        return !truncated && MB_JSON_ScanNumber(valueBuf, valueLen, &info) == valueLen;
+    }
+
+    const char *literal = c == 't' ? "true" : (c == 'f' ? "false" : (c == 'n' ? "null" : NULL));
+    if (!literal)
+        return false;
+
+    for (size_t i = 1; literal[i]; i++)
+    {
+        if (readChar() != literal[i])
+            return false;
+    }
+
+    strcpy(valueBuf, literal);
+    valueLen = strlen(literal);
+    token = c == 'n' ? fb_json_token_null : fb_json_token_boolean;
+    return true;
+}
+
+fb_json_token_type FirebaseJsonReader::next()
+{
+    if (error)
+        return fb_json_token_error;
+
+    keyBuf[0] = '\0';
+    valueBuf[0] = '\0';
+    valueLen = 0;
+    tokenIndex = -1;
+    truncated = false;
+
+    // don't read past the root value
+    if (done || (afterValue && level == 0))
+    {
+        done = true;
+        tokenDepth = 0;
+        token = fb_json_token_end;
+        return token;
+    }
+
+    int c = skipSpace();
+
+    if (afterValue)
+    {
+        if (c != ',')
+            return pop(c);
+        c = skipSpace();
+    }
+    else if (level > 0 && counts[level - 1] == 0 && (c == '}' || c == ']'))
+        return pop(c);
+
+    if (level > 0)
+    {
+        if (stack[level - 1])
+        {
+            size_t len = 0;
+            if (c != '"' || !readString(keyBuf, len) || skipSpace() != ':')
+                return fail();
+            c = skipSpace();
+        }
+        else
+            tokenIndex = counts[level - 1];
+        counts[level - 1]++;
+    }
+
+    started = true;
+    tokenDepth = level;
+
+    if (c == '{' || c == '[')
+        return push(c == '{');
+
+    if (!readValue(c))
+        return fail();
+
+    afterValue = true;
+    return token;
+}
+
+bool FirebaseJsonReader::skip()
+{
+    if ((token != fb_json_token_object_begin && token != fb_json_token_array_begin) || afterValue)
+        return false;
+
+    int depth = 1;
+    bool quoted = false;
+
+    while (depth > 0)
+    {
+        int c = readChar();
+        if (c < 0)
+        {
+            fail();
+            return false;
+        }
+
+        if (quoted)
+        {
+            if (c == '\\')
+                readChar();
+            else if (c == '"')
+                quoted = false;
+        }
+        else if (c == '"')
+            quoted = true;
+        else if (c == '{' || c == '[')
+            depth++;
+        else if (c == '}' || c == ']')
+            depth--;
+    }
+
+    level--;
+    tokenDepth = level;
+    afterValue = true;
+    token = stack[level] ? fb_json_token_object_end : fb_json_token_array_end;
+    return true;
+}
+
+bool FirebaseJsonReader::find(const char *path)
+{
+    if (!path || error)
+        return false;
+
+    if (!started)
+    {
+        fb_json_token_type t = next();
+        if (t != fb_json_token_object_begin && t != fb_json_token_array_begin)
+            return false;
+    }
+
+    MB_VECTOR<MB_String> keys;
+    const char *p = path;
+    while (*p)
+    {
+        const char *e = strchr(p, '/');
+        size_t n = e ? (size_t)(e - p) : strlen(p);
+        if (n > 0)
+        {
+            MB_String key;
+            key.append(p, n);
+            keys.push_back(key);
+        }
+        p += e ? n + 1 : n;
+    }
+
+    if (keys.size() == 0)
+        return true;
+
+    int base = level;
+    size_t matched = 0;
+
+    while (true)
+    {
+        fb_json_token_type t = next();
+
+        if (t == fb_json_token_end || t == fb_json_token_error)
+            return false;
+
+        bool container = t == fb_json_token_object_begin || t == fb_json_token_array_begin;
+
+        if (t == fb_json_token_object_end || t == fb_json_token_array_end)
+        {
+            // the value is not in the object or array that was searched
+            if (level < base)
+                return false;
+            if (level < base + (int)matched)
+                matched = level - base;
+            continue;
+        }
+
+        bool hit = false;
+        const MB_String &k = keys[matched];
+        if (tokenDepth == base + (int)matched)
+        {
+            if (tokenIndex > -1)
+                hit = k.length() > 2 && k[0] == '[' && k[k.length() - 1] == ']' && atoi(k.c_str() + 1) == tokenIndex;
+            else
+                hit = !truncated && strcmp(k.c_str(), keyBuf) == 0;
+        }
+
+        if (hit && matched + 1 == keys.size())
+            return true;
+
+        if (hit && container)
+            matched++;
+        else if (container && !skip())
+            return false;
+    }
+}
+
+bool FirebaseJsonReader::capturePayload(bool object, MB_String &payload)
+{
+    if (token != (object ? fb_json_token_object_begin : fb_json_token_array_begin) || afterValue)
+        return false;
+
+    payload = object ? "{" : "[";
+    capture = &payload;
+    captureFrom = inPos;
+    bool ret = skip();
+    if (inPos > captureFrom)
+        payload.append(in + captureFrom, inPos - captureFrom);
+    capture = NULL;
+    return ret;
+}
+
+bool FirebaseJsonReader::get(FirebaseJson &json)
+{
+    MB_String payload;
+    return capturePayload(true, payload) && json.setJsonData(payload.c_str());
+}
+
+bool FirebaseJsonReader::get(FirebaseJsonArray &arr)
+{
+    MB_String payload;
+    return capturePayload(false, payload) && arr.setJsonArrayData(payload.c_str());
+}
+
+#endif
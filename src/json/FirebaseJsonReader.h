@@ -0,0 +1,232 @@
+/*
+ * FirebaseJsonReader, version 1.0.0
+ *
+ * The pull parser that reads the JSON incrementally from Stream for FirebaseJson library.
+ *
+ * Created October 19, 2026
+ *
+ * Features
+ * - Reading from any Stream e.g. File, Clients (WiFi, Ethernet, and GSM) and Hardware Serial in small blocks
+ *   without loading the whole input to the memory.
+ * - The nesting depth, the key and value buffers are bounded with FIREBASE_JSON_READER_MAX_DEPTH
+ *   and FIREBASE_JSON_READER_BUFFER_SIZE.
+ * - Finding the value at the relative path and building only that subtree as FirebaseJson or FirebaseJsonArray object.
+ *
+ * e.g.
+ *
+ * FirebaseJsonReader reader;
+ * reader.begin(file);
+ * if (reader.find("data/sensors/[2]/name") && reader.type() == fb_json_token_string)
+ *     Serial.println(reader.value());
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FirebaseJsonReader_H
+#define FirebaseJsonReader_H
+
+#include "FirebaseJson.h"
+
+// The maximum nesting depth of arrays and objects, the deeper input is the error.
+#ifndef FIREBASE_JSON_READER_MAX_DEPTH
+#define FIREBASE_JSON_READER_MAX_DEPTH 16
+#endif
+
+// The size of the key and value buffers, the longer key or value is truncated.
+#ifndef FIREBASE_JSON_READER_BUFFER_SIZE
+#define FIREBASE_JSON_READER_BUFFER_SIZE 128
+#endif
+
+// The size of the block that is read from the Stream at once.
+#ifndef FIREBASE_JSON_READER_INPUT_SIZE
+#define FIREBASE_JSON_READER_INPUT_SIZE 64
+#endif
+
+typedef enum
+{
+    fb_json_token_undefined,
+    fb_json_token_object_begin,
+    fb_json_token_object_end,
+    fb_json_token_array_begin,
+    fb_json_token_array_end,
+    fb_json_token_string,
+    fb_json_token_number,
+    fb_json_token_boolean,
+    fb_json_token_null,
+    fb_json_token_end,
+    fb_json_token_error
+} fb_json_token_type;
+
+class FirebaseJsonReader
+{
+public:
+    FirebaseJsonReader() {}
+
+    /**
+     * Start reading the JSON from Stream.
+     *
+     * @param stream The Stream object e.g. File, WiFi/Ethernet Client and Hardware Serial.
+     * @param timeoutMS The time in ms to wait for more data when nothing is available.
+     *
+     * @note The Stream should be positioned at the beginning of JSON e.g. the body of HTTP response.
+     */
+    void begin(Stream &stream, uint32_t timeoutMS = 5000);
+
+    /**
+     * Read the next token.
+     *
+     * @return The fb_json_token_type of the token.
+     *
+     * @note The fb_json_token_end is returned once the root value was read completely.
+     */
+    fb_json_token_type next();
+
+    /**
+     * Read until the value at the relative path and stop at its token.
+     *
+     * @param path The relative path of the value e.g. "a/b/[0]/c" from the current object or array.
+     * @return The boolean value indicates the value was found.
+     *
+     * @note When the current token is not the beginning of object or array, the path is relative to the root value.
+     * The other values are skipped without collecting their keys and values.
+     */
+    bool find(const char *path);
+
+    /**
+     * Skip the object or array that the current token begins.
+     *
+     * @return The boolean status of the operation.
+     */
+    bool skip();
+
+    /**
+     * Build the object that the current token begins as FirebaseJson object.
+     *
+     * @param json The FirebaseJson object to store the object.
+     * @return The boolean status of the operation.
+     *
+     * @note Only this subtree is kept in the memory.
+     */
+    bool get(FirebaseJson &json);
+
+    /**
+     * Build the array that the current token begins as FirebaseJsonArray object.
+     *
+     * @param arr The FirebaseJsonArray object to store the array.
+     * @return The boolean status of the operation.
+     */
+    bool get(FirebaseJsonArray &arr);
+
+    /**
+     * Get the type of the current token.
+     */
+    fb_json_token_type type() { return token; }
+
+    /**
+     * Get the key of the current token when its parent is object, or the empty string.
+     */
+    const char *key() { return keyBuf; }
+
+    /**
+     * Get the unescaped string, the number text or "true", "false" and "null" of the current token.
+     */
+    const char *value() { return valueBuf; }
+
+    /**
+     * Get the length of value().
+     */
+    size_t valueLength() { return valueLen; }
+
+    /**
+     * Get the number of the current token as integer.
+     */
+    int intValue() { return atoi(valueBuf); }
+
+    /**
+     * Get the number of the current token as double.
+     */
+    double doubleValue() { return atof(valueBuf); }
+
+    /**
+     * Get the boolean of the current token.
+     */
+    bool boolValue() { return token == fb_json_token_boolean && valueBuf[0] == 't'; }
+
+    /**
+     * Get the array index of the current token when its parent is array, or -1.
+     */
+    int index() { return tokenIndex; }
+
+    /**
+     * Get the nesting depth of the current token, the root value is at depth 0.
+     */
+    int depth() { return tokenDepth; }
+
+    /**
+     * Check whether the key or value of the current token was longer than FIREBASE_JSON_READER_BUFFER_SIZE and was truncated.
+     */
+    bool isTruncated() { return truncated; }
+
+    /**
+     * Get the count of bytes read from the Stream where the error occurred, or -1.
+     */
+    int errorPosition() { return error ? (int)position : -1; }
+
+private:
+    Stream *stream = NULL;
+    uint32_t timeout = 5000;
+    char in[FIREBASE_JSON_READER_INPUT_SIZE + 1];
+    size_t inLen = 0;
+    size_t inPos = 0;
+    size_t position = 0;
+    char keyBuf[FIREBASE_JSON_READER_BUFFER_SIZE + 1] = {0};
+    char valueBuf[FIREBASE_JSON_READER_BUFFER_SIZE + 1] = {0};
+    size_t valueLen = 0;
+    fb_json_token_type token = fb_json_token_undefined;
+    // the open containers, true for object
+    bool stack[FIREBASE_JSON_READER_MAX_DEPTH];
+    int counts[FIREBASE_JSON_READER_MAX_DEPTH];
+    int level = 0;
+    int tokenDepth = 0;
+    int tokenIndex = -1;
+    bool started = false;
+    bool afterValue = false;
+    bool truncated = false;
+    bool error = false;
+    bool done = false;
+    // the bytes of the subtree being built, collected per block from captureFrom
+    MB_String *capture = NULL;
+    size_t captureFrom = 0;
+
+    int readChar();
+    void unreadChar();
+    int skipSpace();
+    fb_json_token_type fail();
+    fb_json_token_type push(bool object);
+    fb_json_token_type pop(int c);
+    bool readHex(uint32_t &code);
+    bool readString(char *out, size_t &len);
+    bool readValue(int c);
+    bool capturePayload(bool object, MB_String &payload);
+};
+
+#endif
@@ -279,14 +279,18 @@ MB_JSON_Delete(MB_JSON *item)
         {
             MB_JSON_Delete(item->child);
         }
-        if (!(item->type & MB_JSON_IsReference) && (item->valuestring != NULL))
+        if (!(item->type & (MB_JSON_IsReference | MB_JSON_IsInSitu)) && (item->valuestring != NULL))
         {
             MB_JSON_global_hooks.deallocate(item->valuestring);
         }
-        if (!(item->type & MB_JSON_StringIsConst) && (item->string != NULL))
+        if (!(item->type & (MB_JSON_StringIsConst | MB_JSON_StringIsInSitu)) && (item->string != NULL))
         {
             MB_JSON_global_hooks.deallocate(item->string);
         }
+        if (item->index != NULL)
+        {
+            MB_JSON_global_hooks.deallocate(item->index);
+        }
         MB_JSON_global_hooks.deallocate(item);
         item = next;
     }
@@ -310,6 +314,7 @@ typedef struct
     size_t offset;
     size_t depth; /* How deeply nested (in arrays/objects) is the input at the current offset. */
     MB_JSON_internal_hooks hooks;
+    MB_JSON_bool insitu; /* strings are decoded into the content itself */
 } MB_JSON_parse_buffer;
 
 /* check if the given size is left to read in a given parse buffer (starting with 1) */
@@ -320,80 +325,289 @@ typedef struct
 /* get a pointer to the buffer at the position */
 #define MB_JSON_buffer_at_offset(buffer) ((buffer)->content + (buffer)->offset)
 
-/* Parse the input text to generate a number, and populate the result into item. */
-static MB_JSON_bool MB_JSON_parse_number(MB_JSON *const item, MB_JSON_parse_buffer *const input_buffer)
+/* Largest power of ten that is exactly representable as double, together with the
+ * mantissa bits used to decide whether a scanned number can take the exact fast path. */
+#if DBL_MANT_DIG >= 53
+#define MB_JSON_exact_pow10_max 22
+#else
+#define MB_JSON_exact_pow10_max 10
+#endif
+#define MB_JSON_exact_mantissa_max (1ULL << DBL_MANT_DIG)
+
+static const double MB_JSON_exact_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10
+#if DBL_MANT_DIG >= 53
+    ,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+#endif
+};
+
+/* Compute mantissa * 10^exponent when the result is exactly representable (Clinger's fast path).
+ * Returns false when the slow (strtod) path is required. */
+static MB_JSON_bool MB_JSON_fast_pow10(unsigned long long mantissa, int exponent, double *value)
+{
+    if (mantissa > MB_JSON_exact_mantissa_max)
+    {
+        return false;
+    }
+
+    if (mantissa == 0)
+    {
+        *value = 0.0;
+        return true;
+    }
+
+    if (exponent < 0)
+    {
+        if (exponent < -MB_JSON_exact_pow10_max)
+        {
+            return false;
+        }
+        *value = (double)mantissa / MB_JSON_exact_pow10[-exponent];
+        return true;
+    }
+
+    /* shift the excess exponent into the mantissa as long as it stays exact, e.g. 1e25 */
+    while (exponent > MB_JSON_exact_pow10_max)
+    {
+        if (mantissa > MB_JSON_exact_mantissa_max / 10)
+        {
+            return false;
+        }
+        mantissa *= 10;
+        exponent--;
+    }
+
+    *value = (double)mantissa * MB_JSON_exact_pow10[exponent];
+    return true;
+}
+
+/* Slow path, convert the scanned text with strtod. */
+static double MB_JSON_strtod(const unsigned char *number, size_t length)
 {
-    double number = 0;
-    unsigned char *after_end = NULL;
     unsigned char number_c_string[64];
+    unsigned char *buffer = number_c_string;
     unsigned char decimal_point = MB_JSON_get_decimal_point();
+    double value = 0;
     size_t i = 0;
 
-    if ((input_buffer == NULL) || (input_buffer->content == NULL))
+    if (length >= sizeof(number_c_string))
     {
-        return false;
+        buffer = (unsigned char *)MB_JSON_global_hooks.allocate(length + 1);
+        if (buffer == NULL)
+        {
+            return 0;
+        }
     }
 
-    /* copy the number into a temporary buffer and replace '.' with the decimal point
-     * of the current locale (for strtod)
-     * This also takes care of '\0' not necessarily being available for marking the end of the input */
-    for (i = 0; (i < (sizeof(number_c_string) - 1)) && MB_JSON_can_access_at_index(input_buffer, i); i++)
-    {
-        switch (MB_JSON_buffer_at_offset(input_buffer)[i])
-        {
-        case '0':
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-        case '8':
-        case '9':
-        case '+':
-        case '-':
-        case 'e':
-        case 'E':
-            number_c_string[i] = MB_JSON_buffer_at_offset(input_buffer)[i];
-            break;
+    /* replace '.' with the decimal point of the current locale (for strtod) */
+    for (i = 0; i < length; i++)
+    {
+        buffer[i] = (number[i] == '.') ? decimal_point : number[i];
+    }
+    buffer[length] = '\0';
 
-        case '.':
-            number_c_string[i] = decimal_point;
-            break;
+    value = strtod((const char *)buffer, NULL);
 
-        default:
-            goto loop_end;
+    if (buffer != number_c_string)
+    {
+        MB_JSON_global_hooks.deallocate(buffer);
+    }
+
+    return value;
+}
+
+/* Accumulate a decimal digit, returns false when the mantissa would overflow. */
+#define MB_JSON_mantissa_limit 1844674407370955161ULL /* ULLONG_MAX / 10 */
+#define MB_JSON_can_accumulate(mantissa, digit) (((mantissa) < MB_JSON_mantissa_limit) || (((mantissa) == MB_JSON_mantissa_limit) && ((digit) <= 5)))
+
+MB_JSON_PUBLIC(size_t)
+MB_JSON_ScanNumber(const char *number, size_t length, MB_JSON_NumberInfo *info)
+{
+    const unsigned char *start = (const unsigned char *)number;
+    const unsigned char *end = start + length;
+    const unsigned char *p = start;
+    unsigned long long mantissa = 0;
+    int exponent = 0;
+    size_t digits = 0;
+    MB_JSON_bool is_float = false;
+    MB_JSON_bool overflow = false;
+
+    if (info == NULL)
+    {
+        return 0;
+    }
+
+    memset(info, 0, sizeof(MB_JSON_NumberInfo));
+
+    if (number == NULL)
+    {
+        return 0;
+    }
+
+    if ((p < end) && ((*p == '-') || (*p == '+')))
+    {
+        info->negative = (*p == '-');
+        p++;
+    }
+
+    /* integer part, digits that do not fit into the mantissa only scale the exponent */
+    while ((p < end) && (*p >= '0') && (*p <= '9'))
+    {
+        if (!overflow && MB_JSON_can_accumulate(mantissa, (unsigned int)(*p - '0')))
+        {
+            mantissa = mantissa * 10 + (unsigned int)(*p - '0');
+        }
+        else
+        {
+            overflow = true;
+            exponent++;
+        }
+        digits++;
+        p++;
+    }
+
+    /* fraction part */
+    if ((p < end) && (*p == '.'))
+    {
+        is_float = true;
+        p++;
+        while ((p < end) && (*p >= '0') && (*p <= '9'))
+        {
+            if (!overflow && MB_JSON_can_accumulate(mantissa, (unsigned int)(*p - '0')))
+            {
+                mantissa = mantissa * 10 + (unsigned int)(*p - '0');
+                exponent--;
+            }
+            else
+            {
+                overflow = true;
+            }
+            digits++;
+            p++;
+        }
+    }
+
+    if (digits == 0)
+    {
+        return 0; /* parse_error */
+    }
+
+    /* exponent part, only consumed when followed by at least one digit */
+    if ((p < end) && ((*p == 'e') || (*p == 'E')))
+    {
+        const unsigned char *e = p + 1;
+        MB_JSON_bool negative_exponent = false;
+        int exponent_value = 0;
+
+        if ((e < end) && ((*e == '-') || (*e == '+')))
+        {
+            negative_exponent = (*e == '-');
+            e++;
+        }
+
+        if ((e < end) && (*e >= '0') && (*e <= '9'))
+        {
+            while ((e < end) && (*e >= '0') && (*e <= '9'))
+            {
+                if (exponent_value < 100000)
+                {
+                    exponent_value = exponent_value * 10 + (*e - '0');
+                }
+                e++;
+            }
+            exponent += negative_exponent ? -exponent_value : exponent_value;
+            is_float = true;
+            p = e;
+        }
+    }
+
+    info->length = (size_t)(p - start);
+
+    if (!is_float && !overflow)
+    {
+        info->value = (double)mantissa;
+
+        if (info->negative)
+        {
+            info->value = -info->value;
+            if (mantissa <= 2147483648ULL)
+            {
+                info->type = MB_JSON_NumberInt;
+            }
+            else if (mantissa <= 9223372036854775808ULL)
+            {
+                info->type = MB_JSON_NumberInt64;
+            }
+        }
+        else if (mantissa <= 2147483647ULL)
+        {
+            info->type = MB_JSON_NumberInt;
+        }
+        else
+        {
+            info->type = MB_JSON_NumberInt64;
+        }
+
+        if (info->type != MB_JSON_NumberInvalid)
+        {
+            info->integer = mantissa;
+            return info->length;
         }
     }
-loop_end:
-    number_c_string[i] = '\0';
 
-    number = strtod((const char *)number_c_string, (char **)&after_end);
-    if (number_c_string == after_end)
+    info->type = MB_JSON_NumberFloat;
+
+    if (overflow || !MB_JSON_fast_pow10(mantissa, exponent, &info->value))
+    {
+        info->value = MB_JSON_strtod(start, info->length);
+    }
+    else if (info->negative)
+    {
+        info->value = -info->value;
+    }
+
+    return info->length;
+}
+
+/* Parse the input text to generate a number, and populate the result into item. */
+static MB_JSON_bool MB_JSON_parse_number(MB_JSON *const item, MB_JSON_parse_buffer *const input_buffer)
+{
+    MB_JSON_NumberInfo info;
+
+    if ((input_buffer == NULL) || (input_buffer->content == NULL))
+    {
+        return false;
+    }
+
+    if (MB_JSON_ScanNumber((const char *)MB_JSON_buffer_at_offset(input_buffer), input_buffer->length - input_buffer->offset, &info) == 0)
     {
         return false; /* parse_error */
     }
 
-    item->valuedouble = number;
+    item->valuedouble = info.value;
 
     /* use saturation in case of overflow */
-    if (number >= INT_MAX)
+    if (info.type == MB_JSON_NumberInt)
+    {
+        item->valueint = info.negative ? (int)(0 - (long long)info.integer) : (int)info.integer;
+    }
+    else if (info.value >= INT_MAX)
     {
         item->valueint = INT_MAX;
     }
-    else if (number <= (double)INT_MIN)
+    else if (info.value <= (double)INT_MIN)
     {
         item->valueint = INT_MIN;
     }
     else
     {
-        item->valueint = (int)number;
+        item->valueint = (int)info.value;
     }
 
     item->type = MB_JSON_Number;
 
-    input_buffer->offset += (size_t)(after_end - number_c_string);
+    input_buffer->offset += info.length;
     return true;
 }
 
@@ -436,11 +650,12 @@ MB_JSON_SetValuestring(MB_JSON *object, const char *valuestring)
     {
         return NULL;
     }
-    if (object->valuestring != NULL)
+    if (object->valuestring != NULL && !(object->type & MB_JSON_IsInSitu))
     {
         MB_JSON_free(object->valuestring);
     }
     object->valuestring = copy;
+    object->type &= ~MB_JSON_IsInSitu;
 
     return copy;
 }
@@ -454,6 +669,8 @@ typedef struct
     MB_JSON_bool noalloc;
     MB_JSON_bool format; /* is this print a formatted print */
     MB_JSON_internal_hooks hooks;
+    MB_JSON_Writer write; /* receives the printed text when the buffer is full, the buffer is then reused */
+    void *context;
 } MB_JSON_printbuffer;
 
 typedef struct
@@ -463,6 +680,19 @@ typedef struct
     MB_JSON_bool format;
 } MB_JSON_buffer_len_data_t;
 
+/* hand the printed text of MB_JSON_printbuffer over to its writer and rewind */
+static MB_JSON_bool MB_JSON_flush(MB_JSON_printbuffer *const p)
+{
+    p->buffer[p->offset] = '\0';
+    if ((p->offset > 0) && (p->write(p->context, (const char *)p->buffer, p->offset) != p->offset))
+    {
+        return false;
+    }
+    p->offset = 0;
+    p->buffer[0] = '\0';
+    return true;
+}
+
 /* realloc MB_JSON_printbuffer if necessary to have at least "needed" bytes more */
 static unsigned char *MB_JSON_ensure(MB_JSON_printbuffer *const p, size_t needed)
 {
@@ -486,6 +716,15 @@ static unsigned char *MB_JSON_ensure(MB_JSON_printbuffer *const p, size_t needed
         return NULL;
     }
 
+    if ((p->write != NULL) && (needed + p->offset + 1 > p->length))
+    {
+        if (!MB_JSON_flush(p))
+        {
+            return NULL;
+        }
+        /* only a single token that doesn't fit the empty buffer grows it */
+    }
+
     needed += p->offset + 1;
     if (needed <= p->length)
     {
@@ -831,12 +1070,20 @@ static MB_JSON_bool MB_JSON_parse_string(MB_JSON *const item, MB_JSON_parse_buff
             goto fail; /* string ended unexpectedly */
         }
 
-        /* This is at most how much we need for the output */
-        allocation_length = (size_t)(input_end - MB_JSON_buffer_at_offset(input_buffer)) - skipped_bytes;
-        output = (unsigned char *)input_buffer->hooks.allocate(allocation_length + sizeof(""));
-        if (output == NULL)
+        if (input_buffer->insitu)
         {
-            goto fail; /* allocation failure */
+            /* unescaping never grows the text, decode over the literal and terminate at the closing quote */
+            output = (unsigned char *)input_pointer;
+        }
+        else
+        {
+            /* This is at most how much we need for the output */
+            allocation_length = (size_t)(input_end - MB_JSON_buffer_at_offset(input_buffer)) - skipped_bytes;
+            output = (unsigned char *)input_buffer->hooks.allocate(allocation_length + sizeof(""));
+            if (output == NULL)
+            {
+                goto fail; /* allocation failure */
+            }
         }
     }
 
@@ -900,7 +1147,7 @@ static MB_JSON_bool MB_JSON_parse_string(MB_JSON *const item, MB_JSON_parse_buff
     /* zero terminate the output */
     *output_pointer = '\0';
 
-    item->type = MB_JSON_String;
+    item->type = input_buffer->insitu ? MB_JSON_String | MB_JSON_IsInSitu : MB_JSON_String;
     item->valuestring = (char *)output;
 
     input_buffer->offset = (size_t)(input_end - input_buffer->content);
@@ -909,7 +1156,7 @@ static MB_JSON_bool MB_JSON_parse_string(MB_JSON *const item, MB_JSON_parse_buff
     return true;
 
 fail:
-    if (output != NULL)
+    if (output != NULL && !input_buffer->insitu)
     {
         input_buffer->hooks.deallocate(output);
     }
@@ -1170,11 +1417,24 @@ MB_JSON_ParseWithOpts(const char *value, const char **return_parse_end, MB_JSON_
     return MB_JSON_ParseWithLengthOpts(value, buffer_length, return_parse_end, require_null_terminated);
 }
 
+static MB_JSON *MB_JSON_parse_root(const char *value, size_t buffer_length, const char **return_parse_end, MB_JSON_bool require_null_terminated, MB_JSON_bool insitu);
+
 /* Parse an object - create a new root, and populate. */
 MB_JSON_PUBLIC(MB_JSON *)
 MB_JSON_ParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, MB_JSON_bool require_null_terminated)
 {
-    MB_JSON_parse_buffer buffer = {0, 0, 0, 0, {0, 0, 0}};
+    return MB_JSON_parse_root(value, buffer_length, return_parse_end, require_null_terminated, false);
+}
+
+MB_JSON_PUBLIC(MB_JSON *)
+MB_JSON_ParseInSitu(char *value, size_t buffer_length, const char **return_parse_end, MB_JSON_bool require_null_terminated)
+{
+    return MB_JSON_parse_root(value, buffer_length, return_parse_end, require_null_terminated, true);
+}
+
+static MB_JSON *MB_JSON_parse_root(const char *value, size_t buffer_length, const char **return_parse_end, MB_JSON_bool require_null_terminated, MB_JSON_bool insitu)
+{
+    MB_JSON_parse_buffer buffer = {0, 0, 0, 0, {0, 0, 0}, 0};
     MB_JSON *item = NULL;
 
     /* reset error position */
@@ -1190,6 +1450,7 @@ MB_JSON_ParseWithLengthOpts(const char *value, size_t buffer_length, const char
     buffer.length = buffer_length;
     buffer.offset = 0;
     buffer.hooks = MB_JSON_global_hooks;
+    buffer.insitu = insitu;
 
     item = MB_JSON_New_Item(&MB_JSON_global_hooks);
     if (item == NULL) /* memory fail */
@@ -1358,7 +1619,7 @@ MB_JSON_PrintUnformatted(const MB_JSON *item)
 MB_JSON_PUBLIC(char *)
 MB_JSON_PrintBuffered(const MB_JSON *item, int prebuffer, MB_JSON_bool fmt)
 {
-    MB_JSON_printbuffer p = {0, 0, 0, 0, 0, 0, {0, 0, 0}};
+    MB_JSON_printbuffer p = {0, 0, 0, 0, 0, 0, {0, 0, 0}, 0, 0};
 
     if (prebuffer < 0)
     {
@@ -1389,7 +1650,7 @@ MB_JSON_PrintBuffered(const MB_JSON *item, int prebuffer, MB_JSON_bool fmt)
 MB_JSON_PUBLIC(MB_JSON_bool)
 MB_JSON_PrintPreallocated(MB_JSON *item, char *buffer, const int length, const MB_JSON_bool format)
 {
-    MB_JSON_printbuffer p = {0, 0, 0, 0, 0, 0, {0, 0, 0}};
+    MB_JSON_printbuffer p = {0, 0, 0, 0, 0, 0, {0, 0, 0}, 0, 0};
 
     if ((length < 0) || (buffer == NULL))
     {
@@ -1406,6 +1667,49 @@ MB_JSON_PrintPreallocated(MB_JSON *item, char *buffer, const int length, const M
     return MB_JSON_print_value(item, &p);
 }
 
+MB_JSON_PUBLIC(MB_JSON_bool)
+MB_JSON_PrintToWriter(const MB_JSON *item, MB_JSON_bool format, size_t chunk_size, MB_JSON_Writer write, void *context)
+{
+    MB_JSON_printbuffer p = {0, 0, 0, 0, 0, 0, {0, 0, 0}, 0, 0};
+    MB_JSON_bool ret = false;
+
+    if ((item == NULL) || (write == NULL))
+    {
+        return false;
+    }
+
+    if (chunk_size < 16)
+    {
+        chunk_size = 16;
+    }
+
+    p.buffer = (unsigned char *)MB_JSON_global_hooks.allocate(chunk_size);
+    if (p.buffer == NULL)
+    {
+        return false;
+    }
+
+    p.length = chunk_size;
+    p.format = format;
+    p.hooks = MB_JSON_global_hooks;
+    p.write = write;
+    p.context = context;
+
+    if (MB_JSON_print_value(item, &p))
+    {
+        MB_JSON_update_offset(&p);
+        ret = MB_JSON_flush(&p);
+    }
+
+    /* the buffer may be gone when growing failed */
+    if (p.buffer != NULL)
+    {
+        MB_JSON_global_hooks.deallocate(p.buffer);
+    }
+
+    return ret;
+}
+
 /* Parser core - when encountering text, process appropriately. */
 static MB_JSON_bool MB_JSON_parse_value(MB_JSON *const item, MB_JSON_parse_buffer *const input_buffer)
 {
@@ -1927,6 +2231,11 @@ static MB_JSON_bool MB_JSON_parse_object(MB_JSON *const item, MB_JSON_parse_buff
         /* swap valuestring and string, because we parsed the name */
         current_item->string = current_item->valuestring;
         current_item->valuestring = NULL;
+        if (input_buffer->insitu)
+        {
+            /* keep the name out of MB_JSON_Delete even if the value fails to parse */
+            current_item->type = MB_JSON_StringIsInSitu;
+        }
 
         if (MB_JSON_cannot_access_at_index(input_buffer, 0) || (MB_JSON_buffer_at_offset(input_buffer)[0] != ':'))
         {
@@ -1940,6 +2249,10 @@ static MB_JSON_bool MB_JSON_parse_object(MB_JSON *const item, MB_JSON_parse_buff
         {
             goto fail; /* failed to parse value */
         }
+        if (input_buffer->insitu)
+        {
+            current_item->type |= MB_JSON_StringIsInSitu;
+        }
         MB_JSON_buffer_skip_whitespace(input_buffer);
     } while (MB_JSON_can_access_at_index(input_buffer, 0) && (MB_JSON_buffer_at_offset(input_buffer)[0] == ','));
 
@@ -2146,6 +2459,27 @@ static MB_JSON_bool MB_JSON_print_object(const MB_JSON *const item, MB_JSON_prin
     return true;
 }
 
+/* Open addressing (linear probing) index of the object keys, the first child of duplicate keys wins as the linear search does.
+ * The index of an array instead keeps the last accessed item (cursor) and the array size, and its slots hold the items
+ * in their order once the cursor didn't help. */
+struct MB_JSON_index
+{
+    size_t mask;
+    size_t count;
+    MB_JSON_bool duplicates;
+    /* array only */
+    MB_JSON *cursor;
+    size_t position;
+    MB_JSON_bool sized;
+    size_t capacity;
+    MB_JSON *slots[1];
+};
+
+static struct MB_JSON_index *MB_JSON_array_index(MB_JSON *array, MB_JSON_bool with_slots);
+static MB_JSON *MB_JSON_array_index_item(MB_JSON *array, size_t which);
+
+#define MB_JSON_is_array(item) (((item)->type & 0xFF) == MB_JSON_Array)
+
 /* Get Array size/item / object item. */
 MB_JSON_PUBLIC(int)
 MB_JSON_GetArraySize(const MB_JSON *array)
@@ -2158,6 +2492,13 @@ MB_JSON_GetArraySize(const MB_JSON *array)
         return 0;
     }
 
+#if MB_JSON_INDEX_THRESHOLD > 0
+    if ((array->index != NULL) && MB_JSON_is_array(array) && array->index->sized)
+    {
+        return (int)array->index->count;
+    }
+#endif
+
     child = array->child;
 
     while (child != NULL)
@@ -2166,6 +2507,18 @@ MB_JSON_GetArraySize(const MB_JSON *array)
         child = child->next;
     }
 
+#if MB_JSON_INDEX_THRESHOLD > 0
+    if ((size >= MB_JSON_INDEX_THRESHOLD) && MB_JSON_is_array(array) && !(array->type & MB_JSON_IsReference))
+    {
+        struct MB_JSON_index *index = MB_JSON_array_index((MB_JSON *)array, false);
+        if (index != NULL)
+        {
+            index->count = size;
+            index->sized = true;
+        }
+    }
+#endif
+
     /* FIXME: Can overflow here. Cannot be fixed without breaking the API */
 
     return (int)size;
@@ -2174,12 +2527,22 @@ MB_JSON_GetArraySize(const MB_JSON *array)
 static MB_JSON *MB_JSON_get_array_item(const MB_JSON *array, size_t index)
 {
     MB_JSON *current_child = NULL;
+#if MB_JSON_INDEX_THRESHOLD > 0
+    size_t which = index;
+#endif
 
     if (array == NULL)
     {
         return NULL;
     }
 
+#if MB_JSON_INDEX_THRESHOLD > 0
+    if ((array->index != NULL) && MB_JSON_is_array(array))
+    {
+        return MB_JSON_array_index_item((MB_JSON *)array, index);
+    }
+#endif
+
     current_child = array->child;
     while ((current_child != NULL) && (index > 0))
     {
@@ -2187,6 +2550,19 @@ static MB_JSON *MB_JSON_get_array_item(const MB_JSON *array, size_t index)
         current_child = current_child->next;
     }
 
+#if MB_JSON_INDEX_THRESHOLD > 0
+    if ((current_child != NULL) && (which >= MB_JSON_INDEX_THRESHOLD) && MB_JSON_is_array(array) && !(array->type & MB_JSON_IsReference))
+    {
+        /* the index is a cache, it doesn't change the content */
+        struct MB_JSON_index *cursor = MB_JSON_array_index((MB_JSON *)array, false);
+        if (cursor != NULL)
+        {
+            cursor->cursor = current_child;
+            cursor->position = which;
+        }
+    }
+#endif
+
     return current_child;
 }
 
@@ -2201,6 +2577,360 @@ MB_JSON_GetArrayItem(const MB_JSON *array, int index)
     return MB_JSON_get_array_item(array, (size_t)index);
 }
 
+static size_t MB_JSON_hash_key(const char *key)
+{
+    /* FNV-1a */
+    unsigned long hash = 2166136261UL;
+    while (*key != '\0')
+    {
+        hash = (hash ^ (unsigned char)*key++) * 16777619UL;
+    }
+    return (size_t)hash;
+}
+
+/* Get the slot of the key, or the empty slot to place it. */
+static MB_JSON **MB_JSON_index_slot(struct MB_JSON_index *index, const char *key)
+{
+    size_t i = MB_JSON_hash_key(key) & index->mask;
+    while ((index->slots[i] != NULL) && (strcmp(key, index->slots[i]->string) != 0))
+    {
+        i = (i + 1) & index->mask;
+    }
+    return &index->slots[i];
+}
+
+static void MB_JSON_index_add(struct MB_JSON_index *index, MB_JSON *item)
+{
+    MB_JSON **slot = MB_JSON_index_slot(index, item->string);
+    if (*slot != NULL)
+    {
+        index->duplicates = true;
+        return;
+    }
+    *slot = item;
+    index->count++;
+}
+
+static void MB_JSON_drop_index(MB_JSON *object)
+{
+    if (object->index != NULL)
+    {
+        MB_JSON_global_hooks.deallocate(object->index);
+        object->index = NULL;
+    }
+}
+
+static void MB_JSON_create_index(MB_JSON *object)
+{
+    struct MB_JSON_index *index = NULL;
+    MB_JSON *child = object->child;
+    size_t count = 0;
+    size_t size = 8;
+
+    while (child != NULL)
+    {
+        if (child->string == NULL)
+        {
+            return; /* the linear search stops here, keep it */
+        }
+        count++;
+        child = child->next;
+    }
+
+    /* keep the load factor under 2/3 */
+    while (size < count + count / 2 + 1)
+    {
+        size <<= 1;
+    }
+
+    index = (struct MB_JSON_index *)MB_JSON_global_hooks.allocate(sizeof(struct MB_JSON_index) + (size - 1) * sizeof(MB_JSON *));
+    if (index == NULL)
+    {
+        return; /* search linearly */
+    }
+    memset(index, 0, sizeof(struct MB_JSON_index) + (size - 1) * sizeof(MB_JSON *));
+    index->mask = size - 1;
+
+    for (child = object->child; child != NULL; child = child->next)
+    {
+        MB_JSON_index_add(index, child);
+    }
+
+    object->index = index;
+}
+
+/* Create the index of the array, or rebuild it with the slots of all items. Returns the current index if it fails. */
+static struct MB_JSON_index *MB_JSON_array_index(MB_JSON *array, MB_JSON_bool with_slots)
+{
+    struct MB_JSON_index *index = array->index;
+    struct MB_JSON_index *rebuilt = NULL;
+    MB_JSON *child = NULL;
+    size_t count = 0;
+    size_t capacity = 0;
+
+    if ((index != NULL) && (!with_slots || (index->capacity > 0)))
+    {
+        return index;
+    }
+
+    if (with_slots)
+    {
+        for (child = array->child; child != NULL; child = child->next)
+        {
+            count++;
+        }
+        /* room for the appended items */
+        capacity = count + count / 2 + 8;
+    }
+
+    rebuilt = (struct MB_JSON_index *)MB_JSON_global_hooks.allocate(sizeof(struct MB_JSON_index) + (capacity > 0 ? capacity - 1 : 0) * sizeof(MB_JSON *));
+    if (rebuilt == NULL)
+    {
+        return index;
+    }
+    memset(rebuilt, 0, sizeof(struct MB_JSON_index));
+
+    if (index != NULL)
+    {
+        rebuilt->cursor = index->cursor;
+        rebuilt->position = index->position;
+    }
+
+    if (with_slots)
+    {
+        rebuilt->capacity = capacity;
+        rebuilt->count = count;
+        rebuilt->sized = true;
+        count = 0;
+        for (child = array->child; child != NULL; child = child->next)
+        {
+            rebuilt->slots[count++] = child;
+        }
+    }
+
+    MB_JSON_drop_index(array);
+    array->index = rebuilt;
+    return rebuilt;
+}
+
+/* Get the array item from the slots, or walk from the nearest of the first item, the cursor and the last item. */
+static MB_JSON *MB_JSON_array_index_item(MB_JSON *array, size_t which)
+{
+    struct MB_JSON_index *index = array->index;
+    MB_JSON *item = array->child;
+    size_t steps = which;
+    MB_JSON_bool forward = true;
+
+    if (index->capacity > 0)
+    {
+        return (which < index->count) ? index->slots[which] : NULL;
+    }
+
+    if (index->sized && (which >= index->count))
+    {
+        return NULL;
+    }
+
+    if (index->cursor != NULL)
+    {
+        if ((which >= index->position) && (which - index->position < steps))
+        {
+            item = index->cursor;
+            steps = which - index->position;
+        }
+        else if ((which < index->position) && (index->position - which < steps))
+        {
+            item = index->cursor;
+            steps = index->position - which;
+            forward = false;
+        }
+    }
+
+    if (index->sized && (index->count - 1 - which < steps) && (array->child != NULL))
+    {
+        item = array->child->prev;
+        steps = index->count - 1 - which;
+        forward = false;
+    }
+
+    while ((item != NULL) && (steps > 0))
+    {
+        item = forward ? item->next : item->prev;
+        steps--;
+    }
+
+    if (item == NULL)
+    {
+        return NULL;
+    }
+
+    if (which >= MB_JSON_INDEX_THRESHOLD)
+    {
+        steps = (index->cursor == NULL) ? which : ((which > index->position) ? which - index->position : index->position - which);
+        if (steps >= MB_JSON_INDEX_THRESHOLD)
+        {
+            /* the access is random, collect the items */
+            index = MB_JSON_array_index(array, true);
+        }
+    }
+
+    index->cursor = item;
+    index->position = which;
+    return item;
+}
+
+/* Keep the index of the array after the item was appended. */
+static void MB_JSON_array_index_append(MB_JSON *array, MB_JSON *item)
+{
+    struct MB_JSON_index *index = array->index;
+
+    if (index->capacity > 0)
+    {
+        if (index->count == index->capacity)
+        {
+            MB_JSON_drop_index(array);
+            return;
+        }
+        index->slots[index->count] = item;
+    }
+
+    if (index->sized)
+    {
+        index->count++;
+    }
+}
+
+/* Keep the index of the array after the item was detached, only the last item keeps the positions. */
+static void MB_JSON_array_index_remove(MB_JSON *array, MB_JSON *item)
+{
+    struct MB_JSON_index *index = array->index;
+
+    if ((item->next != NULL) || !index->sized || (index->count == 0))
+    {
+        MB_JSON_drop_index(array);
+        return;
+    }
+
+    if (index->cursor == item)
+    {
+        index->cursor = NULL;
+    }
+    index->count--;
+}
+
+/* Keep the index of the array after the item was replaced. */
+static void MB_JSON_array_index_replace(MB_JSON *array, MB_JSON *item, MB_JSON *replacement)
+{
+    struct MB_JSON_index *index = array->index;
+
+    if (index->cursor == item)
+    {
+        index->cursor = replacement;
+        if ((index->capacity > 0) && (index->position < index->count))
+        {
+            index->slots[index->position] = replacement;
+        }
+    }
+    else if (index->capacity > 0)
+    {
+        MB_JSON_drop_index(array);
+    }
+}
+
+/* Keep the index of the parent after the item was appended. */
+static void MB_JSON_index_append(MB_JSON *parent, MB_JSON *item)
+{
+    struct MB_JSON_index *index = parent->index;
+    if (MB_JSON_is_array(parent))
+    {
+        MB_JSON_array_index_append(parent, item);
+        return;
+    }
+    if ((item->string == NULL) || ((index->count + 1) * 3 > (index->mask + 1) * 2))
+    {
+        /* rebuild on the next lookup */
+        MB_JSON_drop_index(parent);
+        return;
+    }
+    MB_JSON_index_add(index, item);
+}
+
+/* Keep the index of the parent after the item was detached. */
+static void MB_JSON_index_remove(MB_JSON *parent, MB_JSON *item)
+{
+    struct MB_JSON_index *index = parent->index;
+    MB_JSON **slot = NULL;
+    size_t i = 0;
+    size_t j = 0;
+    size_t k = 0;
+
+    if (MB_JSON_is_array(parent))
+    {
+        MB_JSON_array_index_remove(parent, item);
+        return;
+    }
+
+    if (index->duplicates || (item->string == NULL))
+    {
+        /* the shadowed duplicate may become visible */
+        MB_JSON_drop_index(parent);
+        return;
+    }
+
+    slot = MB_JSON_index_slot(index, item->string);
+    if (*slot != item)
+    {
+        MB_JSON_drop_index(parent);
+        return;
+    }
+
+    /* backward shift the following entries of the probe chain */
+    i = (size_t)(slot - index->slots);
+    j = i;
+    for (;;)
+    {
+        j = (j + 1) & index->mask;
+        if (index->slots[j] == NULL)
+        {
+            break;
+        }
+        k = MB_JSON_hash_key(index->slots[j]->string) & index->mask;
+        /* move it when its home slot k is not cyclically within (i, j] */
+        if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j)))
+        {
+            continue;
+        }
+        index->slots[i] = index->slots[j];
+        i = j;
+    }
+    index->slots[i] = NULL;
+    index->count--;
+}
+
+/* Keep the index of the parent after the item was replaced. */
+static void MB_JSON_index_replace(MB_JSON *parent, MB_JSON *item, MB_JSON *replacement)
+{
+    MB_JSON **slot = NULL;
+
+    if (MB_JSON_is_array(parent))
+    {
+        MB_JSON_array_index_replace(parent, item, replacement);
+        return;
+    }
+
+    if ((item->string == NULL) || (replacement->string == NULL) || (strcmp(item->string, replacement->string) != 0))
+    {
+        MB_JSON_drop_index(parent);
+        return;
+    }
+
+    slot = MB_JSON_index_slot(parent->index, item->string);
+    if (*slot == item)
+    {
+        *slot = replacement;
+    }
+}
+
 static MB_JSON *MB_JSON_get_object_item(const MB_JSON *const object, const char *const name, const MB_JSON_bool case_sensitive)
 {
     MB_JSON *current_element = NULL;
@@ -2213,10 +2943,31 @@ static MB_JSON *MB_JSON_get_object_item(const MB_JSON *const object, const char
     current_element = object->child;
     if (case_sensitive)
     {
+#if MB_JSON_INDEX_THRESHOLD > 0
+        size_t walked = 0;
+
+        if ((object->index != NULL) && !MB_JSON_is_array(object))
+        {
+            return *MB_JSON_index_slot(object->index, name);
+        }
+
+        while ((current_element != NULL) && (current_element->string != NULL) && (strcmp(name, current_element->string) != 0))
+        {
+            current_element = current_element->next;
+            walked++;
+        }
+
+        if ((walked >= MB_JSON_INDEX_THRESHOLD) && !MB_JSON_is_array(object) && !(object->type & MB_JSON_IsReference))
+        {
+            /* the index is a cache, it doesn't change the content */
+            MB_JSON_create_index((MB_JSON *)object);
+        }
+#else
         while ((current_element != NULL) && (current_element->string != NULL) && (strcmp(name, current_element->string) != 0))
         {
             current_element = current_element->next;
         }
+#endif
     }
     else
     {
@@ -2276,6 +3027,7 @@ static MB_JSON *MB_JSON_create_reference(const MB_JSON *item, const MB_JSON_inte
 
     memcpy(reference, item, sizeof(MB_JSON));
     reference->string = NULL;
+    reference->index = NULL;
     reference->type |= MB_JSON_IsReference;
     reference->next = reference->prev = NULL;
     return reference;
@@ -2311,6 +3063,11 @@ static MB_JSON_bool MB_JSON_add_item_to_array(MB_JSON *array, MB_JSON *item)
         }
     }
 
+    if (array->index != NULL)
+    {
+        MB_JSON_index_append(array, item);
+    }
+
     return true;
 }
 
@@ -2362,13 +3119,13 @@ static MB_JSON_bool MB_JSON_add_item_to_object(MB_JSON *const object, const char
         new_type = item->type & ~MB_JSON_StringIsConst;
     }
 
-    if (!(item->type & MB_JSON_StringIsConst) && (item->string != NULL))
+    if (!(item->type & (MB_JSON_StringIsConst | MB_JSON_StringIsInSitu)) && (item->string != NULL))
     {
         hooks->deallocate(item->string);
     }
 
     item->string = new_key;
-    item->type = new_type;
+    item->type = new_type & ~MB_JSON_StringIsInSitu;
 
     return MB_JSON_add_item_to_array(object, item);
 }
@@ -2533,6 +3290,11 @@ MB_JSON_DetachItemViaPointer(MB_JSON *parent, MB_JSON *const item)
         return NULL;
     }
 
+    if (parent->index != NULL)
+    {
+        MB_JSON_index_remove(parent, item);
+    }
+
     if (item != parent->child)
     {
         /* not the first element */
@@ -2624,6 +3386,11 @@ MB_JSON_InsertItemInArray(MB_JSON *array, int which, MB_JSON *newitem)
         return MB_JSON_add_item_to_array(array, newitem);
     }
 
+    if (array->index != NULL)
+    {
+        MB_JSON_drop_index(array);
+    }
+
     newitem->next = after_inserted;
     newitem->prev = after_inserted->prev;
     after_inserted->prev = newitem;
@@ -2651,6 +3418,11 @@ MB_JSON_ReplaceItemViaPointer(MB_JSON *const parent, MB_JSON *const item, MB_JSO
         return true;
     }
 
+    if (parent->index != NULL)
+    {
+        MB_JSON_index_replace(parent, item, replacement);
+    }
+
     replacement->next = item->next;
     replacement->prev = item->prev;
 
@@ -2707,12 +3479,12 @@ static MB_JSON_bool MB_JSON_replace_item_in_object(MB_JSON *object, const char *
     }
 
     /* replace the name in the replacement */
-    if (!(replacement->type & MB_JSON_StringIsConst) && (replacement->string != NULL))
+    if (!(replacement->type & (MB_JSON_StringIsConst | MB_JSON_StringIsInSitu)) && (replacement->string != NULL))
     {
         MB_JSON_free(replacement->string);
     }
     replacement->string = (char *)MB_JSON_strdup((const unsigned char *)string, &MB_JSON_global_hooks);
-    replacement->type &= ~MB_JSON_StringIsConst;
+    replacement->type &= ~(MB_JSON_StringIsConst | MB_JSON_StringIsInSitu);
 
     return MB_JSON_ReplaceItemViaPointer(object, MB_JSON_get_object_item(object, string, case_sensitive), replacement);
 }
@@ -3094,7 +3866,7 @@ MB_JSON_Duplicate(const MB_JSON *item, MB_JSON_bool recurse)
         goto fail;
     }
     /* Copy over all vars */
-    newitem->type = item->type & (~MB_JSON_IsReference);
+    newitem->type = item->type & ~(MB_JSON_IsReference | MB_JSON_IsInSitu | MB_JSON_StringIsInSitu);
     newitem->valueint = item->valueint;
     newitem->valuedouble = item->valuedouble;
     if (item->valuestring)
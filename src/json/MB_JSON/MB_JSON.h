@@ -106,6 +106,9 @@ then using the MB_JSON_API_VISIBILITY flag to "export" the same symbols the way
 
 #define MB_JSON_IsReference 256
 #define MB_JSON_StringIsConst 512
+/* valuestring / string point into the caller's buffer given to MB_JSON_ParseInSitu and are not freed */
+#define MB_JSON_IsInSitu 1024
+#define MB_JSON_StringIsInSitu 2048
 
 /* The MB_JSON structure: */
 typedef struct MB_JSON
@@ -128,6 +131,10 @@ typedef struct MB_JSON
 
     /* The item's name string, if this item is the child of, or is in the list of subitems of an object. */
     char *string;
+
+    /* Key index of a large object or position index of a large array, built on lookup and kept by the add/detach/replace functions.
+     * Don't relink the children or rename their keys directly while it was set. */
+    struct MB_JSON_index *index;
 } MB_JSON;
 
 typedef struct MB_JSON_Hooks
@@ -140,12 +147,42 @@ typedef struct MB_JSON_Hooks
 
 typedef int MB_JSON_bool;
 
+/* Number classes reported by MB_JSON_ScanNumber */
+#define MB_JSON_NumberInvalid (0)
+#define MB_JSON_NumberInt     (1) /* integer within the signed 32-bit range */
+#define MB_JSON_NumberInt64   (2) /* integer within the signed (negative) or unsigned (positive) 64-bit range */
+#define MB_JSON_NumberFloat   (3) /* has fraction or exponent, or the integer overflows 64-bit */
+
+typedef struct MB_JSON_NumberInfo
+{
+    /* One of the MB_JSON_Number... classes above. */
+    int type;
+    /* The sign of the number. */
+    MB_JSON_bool negative;
+    /* The magnitude of integer classes (the sign is in negative). */
+    unsigned long long integer;
+    /* The number as double, exact unless the input is not representable. */
+    double value;
+    /* The count of characters consumed. */
+    size_t length;
+} MB_JSON_NumberInfo;
+
+/* Receives the text printed by MB_JSON_PrintToWriter (zero terminated after length bytes), returns the count of bytes written. */
+typedef size_t (*MB_JSON_Writer)(void *context, const char *data, size_t length);
+
 /* Limits how deeply nested arrays/objects can be before MB_JSON rejects to parse them.
  * This is to prevent stack overflows. */
 #ifndef MB_JSON_NESTING_LIMIT
 #define MB_JSON_NESTING_LIMIT 1000
 #endif
 
+/* The count of object children walked by a case sensitive lookup before the hash index of its keys is built,
+ * and the array position walked to before the array keeps its cursor (and its items when accessed randomly).
+ * Define as 0 to always search linearly and save the index memory. */
+#ifndef MB_JSON_INDEX_THRESHOLD
+#define MB_JSON_INDEX_THRESHOLD 32
+#endif
+
 /* returns the version of MB_JSON as a string */
 MB_JSON_PUBLIC(const char*) MB_JSON_Version(void);
 
@@ -163,6 +200,13 @@ MB_JSON_PUBLIC(MB_JSON *) MB_JSON_ParseWithLength(const char *value, size_t buff
 /* If you supply a ptr in return_parse_end and parsing fails, then return_parse_end will contain a pointer to the error so will match MB_JSON_GetErrorPtr(). */
 MB_JSON_PUBLIC(MB_JSON *) MB_JSON_ParseWithOpts(const char *value, const char **return_parse_end, MB_JSON_bool require_null_terminated);
 MB_JSON_PUBLIC(MB_JSON *) MB_JSON_ParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, MB_JSON_bool require_null_terminated);
+/* Parse in place: strings are unescaped and zero terminated inside value, and the keys and string values of the result point into it.
+ * The buffer is modified and must stay valid until the result was deleted. MB_JSON_Duplicate gives a copy that no longer depends on it. */
+MB_JSON_PUBLIC(MB_JSON *) MB_JSON_ParseInSitu(char *value, size_t buffer_length, const char **return_parse_end, MB_JSON_bool require_null_terminated);
+
+/* Scan a JSON number from the first length characters of number in a single pass and classify it as integer, 64-bit integer or float.
+ * Returns the count of characters consumed or 0 if no number was found. */
+MB_JSON_PUBLIC(size_t) MB_JSON_ScanNumber(const char *number, size_t length, MB_JSON_NumberInfo *info);
 
 /* Render a MB_JSON entity to text for transfer/storage. */
 MB_JSON_PUBLIC(char *) MB_JSON_Print(const MB_JSON *item);
@@ -173,6 +217,9 @@ MB_JSON_PUBLIC(char *) MB_JSON_PrintBuffered(const MB_JSON *item, int prebuffer,
 /* Render a MB_JSON entity to text using a buffer already allocated in memory with given length. Returns 1 on success and 0 on failure. */
 /* NOTE: MB_JSON is not always 100% accurate in estimating how much memory it will use, so to be safe allocate 5 bytes more than you actually need */
 MB_JSON_PUBLIC(MB_JSON_bool) MB_JSON_PrintPreallocated(MB_JSON *item, char *buffer, const int length, const MB_JSON_bool format);
+/* Render a MB_JSON entity to text through a buffer of chunk_size bytes that is handed to write whenever it is full, instead of keeping the whole text in memory.
+ * The buffer only grows for a single string or raw value longer than it. Returns 1 on success and 0 when printing or writing failed. */
+MB_JSON_PUBLIC(MB_JSON_bool) MB_JSON_PrintToWriter(const MB_JSON *item, MB_JSON_bool format, size_t chunk_size, MB_JSON_Writer write, void *context);
 /* Delete a MB_JSON entity and all subentities. */
 MB_JSON_PUBLIC(void) MB_JSON_Delete(MB_JSON *item);
 
@@ -1,11 +1,18 @@
 
 /**
- * Mobizt's SRAM/PSRAM supported String, version 1.2.12
+ * Mobizt's SRAM/PSRAM supported String, version 1.2.13
  *
- * Created March 25, 2024
+ * Created October 19, 2026
  *
  * Changes Log
  *
+ * v1.2.13
+ * - small string optimization (SSO), the short string is stored in the object without heap allocation
+ * - add move constructor and move assignment
+ * - the buffer grows by 1.5 times of its capacity to reduce the reallocation when appending
+ * - add capacity(), erase and pop_back keep the buffer, use shrink_to_fit to release the unused memory
+ * - add MB_StringView, the non-owning view of the characters for scanning without copy
+ *
  * v1.2.12
  * - using std namespace
  * 
@@ -103,6 +110,26 @@
 #define ESP8266_USE_EXTERNAL_HEAP
 #endif
 
+// The size of the buffer inside the object for the short string (including the terminator), 0 to always allocate.
+#if !defined(MB_STRING_SSO_SIZE)
+#if defined(__AVR__) || defined(ESP8266_USE_EXTERNAL_HEAP)
+#define MB_STRING_SSO_SIZE 0
+#else
+#define MB_STRING_SSO_SIZE 16
+#endif
+#endif
+
+// The maximum extra bytes added when the buffer grows by 1.5 times of its capacity, 0 for no limit.
+#if !defined(MB_STRING_MAX_GROWTH)
+#if defined(__AVR__)
+#define MB_STRING_MAX_GROWTH 32
+#elif defined(ESP8266)
+#define MB_STRING_MAX_GROWTH 1024
+#else
+#define MB_STRING_MAX_GROWTH 0
+#endif
+#endif
+
 #if defined(ESP8266) || defined(ESP32)
 #define MBSTRING_FLASH_MCR FPSTR
 #elif defined(ARDUINO_ARCH_SAMD) || defined(__AVR_ATmega4809__) || defined(ARDUINO_NANO_RP2040_CONNECT)
@@ -112,6 +139,7 @@
 #endif
 
 class MB_String;
+class MB_StringView;
 
 #define pgm2Str(p) (MB_String().appendP(p).c_str())
 #define num2Str(v, p) (MB_String().appendNum(v, p).c_str())
@@ -147,7 +175,7 @@ namespace mb_string
     {
 
     public:
-        mb_string_ptr_t(uint32_t addr = 0, mb_string_sub_type type = mb_string_sub_type_cstring, int precision = -1, const StringSumHelper *s = nullptr)
+        mb_string_ptr_t(uintptr_t addr = 0, mb_string_sub_type type = mb_string_sub_type_cstring, int precision = -1, const StringSumHelper *s = nullptr)
         {
             _addr = addr;
             _type = type;
@@ -156,13 +184,13 @@ namespace mb_string
         }
         int precision() { return _precision; }
         mb_string_sub_type type() { return _type; }
-        uint32_t address() { return _addr; }
+        uintptr_t address() { return _addr; }
         const StringSumHelper *stringsumhelper() { return _ssh; }
 
     private:
         mb_string_sub_type _type = mb_string_sub_type_none;
         int _precision = -1;
-        uint32_t _addr = 0;
+        uintptr_t _addr = 0;
         const StringSumHelper *_ssh = nullptr;
 
     } MB_StringPtr;
@@ -389,17 +417,17 @@ namespace mb_string
     };
 
     template <typename T>
-    uint32_t toAddr(T &v) { return reinterpret_cast<uint32_t>(&v); }
+    uintptr_t toAddr(T &v) { return reinterpret_cast<uintptr_t>(&v); }
 
 #if defined(__AVR__)
     template <typename T>
-    T addrTo(int address)
+    T addrTo(uintptr_t address)
     {
         return reinterpret_cast<T>(address);
     }
 #else
     template <typename T>
-    auto addrTo(int address) -> typename std::enable_if<!std::is_same<T, nullptr_t>::value, T>::type
+    auto addrTo(uintptr_t address) -> typename std::enable_if<!std::is_same<T, nullptr_t>::value, T>::type
     {
         return reinterpret_cast<T>(address);
     }
@@ -457,25 +485,25 @@ namespace mb_string
     template <typename T>
     auto toStringPtr(const T &val) -> typename std::enable_if<is_std_string<T>::value || is_arduino_string<T>::value || is_mb_string<T>::value, MB_StringPtr>::type
     {
-        return MB_StringPtr(reinterpret_cast<uint32_t>(&val), getSubType(val));
+        return MB_StringPtr(reinterpret_cast<uintptr_t>(&val), getSubType(val));
     }
 
     template <typename T>
     auto toStringPtr(const T &val) -> typename std::enable_if<std::is_same<T, StringSumHelper>::value, MB_StringPtr>::type
     {
 #if defined(ESP8266)
-        return MB_StringPtr(reinterpret_cast<uint32_t>(&val), getSubType(val), -1);
+        return MB_StringPtr(reinterpret_cast<uintptr_t>(&val), getSubType(val), -1);
 
 #else
-        return MB_StringPtr(reinterpret_cast<uint32_t>(&val), getSubType(val), -1, &val);
+        return MB_StringPtr(reinterpret_cast<uintptr_t>(&val), getSubType(val), -1, &val);
 #endif
     }
 
     template <typename T>
-    auto toStringPtr(T val) -> typename std::enable_if<is_const_chars<T>::value, MB_StringPtr>::type { return MB_StringPtr(reinterpret_cast<uint32_t>(val), getSubType(val)); }
+    auto toStringPtr(T val) -> typename std::enable_if<is_const_chars<T>::value, MB_StringPtr>::type { return MB_StringPtr(reinterpret_cast<uintptr_t>(val), getSubType(val)); }
 
     template <typename T>
-    auto toStringPtr(T &val) -> typename std::enable_if<is_arduino_flash_string_helper<T>::value, MB_StringPtr>::type { return MB_StringPtr(reinterpret_cast<uint32_t>(val), getSubType(val)); }
+    auto toStringPtr(T &val) -> typename std::enable_if<is_arduino_flash_string_helper<T>::value, MB_StringPtr>::type { return MB_StringPtr(reinterpret_cast<uintptr_t>(val), getSubType(val)); }
 
 #if !defined(__AVR__)
     template <typename T>
@@ -492,7 +520,7 @@ namespace mb_string
     }
 
     template <typename T>
-    auto toStringPtr(T &val, int precision = -1) -> typename std::enable_if<is_num_int<T>::value || is_num_float<T>::value || std::is_same<T, bool>::value, MB_StringPtr>::type { return MB_StringPtr(reinterpret_cast<uint32_t>(&val), getSubType(val), precision); }
+    auto toStringPtr(T &val, int precision = -1) -> typename std::enable_if<is_num_int<T>::value || is_num_float<T>::value || std::is_same<T, bool>::value, MB_StringPtr>::type { return MB_StringPtr(reinterpret_cast<uintptr_t>(&val), getSubType(val), precision); }
 }
 
 using namespace mb_string;
@@ -524,6 +552,13 @@ public:
         *this = value;
     }
 
+    MB_String(const MB_StringView &value);
+
+    MB_String(MB_String &&value)
+    {
+        move(value);
+    }
+
     MB_String(const __FlashStringHelper *str)
     {
         *this = str;
@@ -748,12 +783,22 @@ public:
         return *this;
     }
 
+    MB_String &operator=(MB_String &&rhs)
+    {
+        move(rhs);
+        return *this;
+    }
+
     MB_String &operator+=(const MB_String &rhs)
     {
         concat(rhs);
         return (*this);
     }
 
+    MB_String &operator=(const MB_StringView &rhs);
+
+    MB_String &operator+=(const MB_StringView &rhs);
+
     MB_String &operator+=(const char *cstr)
     {
         size_t len = strlen_P(cstr);
@@ -1103,7 +1148,23 @@ public:
 
     void swap(MB_String &rhs)
     {
-        rhs.clear();
+#if MB_STRING_SSO_SIZE > 0
+        // the inline buffer stays with its object, its content is copied
+        if (isInline() || rhs.isInline())
+        {
+            MB_String tmp;
+            tmp.move(rhs);
+            rhs.move(*this);
+            move(tmp);
+            return;
+        }
+#endif
+        char *tmp = buf;
+        size_t len = bufLen;
+        buf = rhs.buf;
+        bufLen = rhs.bufLen;
+        rhs.buf = tmp;
+        rhs.bufLen = len;
     }
 
     void shrink_to_fit()
@@ -1114,13 +1175,9 @@ public:
 
     void pop_back()
     {
-        if (length() > 0)
-        {
-            size_t slen = length();
-            if (slen > 0)
-                buf[slen - 1] = '\0';
-            _reserve(slen, true);
-        }
+        size_t slen = length();
+        if (slen > 0)
+            buf[slen - 1] = '\0';
     }
 
     size_t size() const
@@ -1133,6 +1190,11 @@ public:
         return bufLen;
     }
 
+    size_t capacity() const
+    {
+        return maxLength();
+    }
+
     size_t find(const MB_String &s, size_t index = 0) const
     {
         if (!s.buf)
@@ -1174,8 +1236,6 @@ public:
         memmove(buf + index, buf + index + len, rightLen);
 
         buf[index + rightLen] = '\0';
-
-        _reserve(length(), true);
     }
 
     size_t length() const
@@ -1482,14 +1542,16 @@ private:
     char *int32Str(signed long value)
     {
         char *t = (char *)newP(64);
-        sprintf(t, (const char *)MBSTRING_FLASH_MCR("%ld"), value);
+        if (t)
+            sprintf(t, (const char *)MBSTRING_FLASH_MCR("%ld"), value);
         return t;
     }
 
     char *uint32Str(unsigned long value)
     {
         char *t = (char *)newP(64);
-        sprintf(t, (const char *)MBSTRING_FLASH_MCR("%lu"), value);
+        if (t)
+            sprintf(t, (const char *)MBSTRING_FLASH_MCR("%lu"), value);
         return t;
     }
 
@@ -1498,21 +1560,24 @@ private:
     char *int64Str(signed long long value)
     {
         char *t = (char *)newP(64);
-        sprintf(t, (const char *)MBSTRING_FLASH_MCR("%lld"), value);
+        if (t)
+            sprintf(t, (const char *)MBSTRING_FLASH_MCR("%lld"), value);
         return t;
     }
 
     char *uint64Str(unsigned long long value)
     {
         char *t = (char *)newP(64);
-        sprintf(t, (const char *)MBSTRING_FLASH_MCR("%llu"), value);
+        if (t)
+            sprintf(t, (const char *)MBSTRING_FLASH_MCR("%llu"), value);
         return t;
     }
 
     char *boolStr(bool value)
     {
         char *t = (char *)newP(8);
-        value ? strcpy(t, (const char *)MBSTRING_FLASH_MCR("true")) : strcpy(t, (const char *)MBSTRING_FLASH_MCR("false"));
+        if (t)
+            value ? strcpy(t, (const char *)MBSTRING_FLASH_MCR("true")) : strcpy(t, (const char *)MBSTRING_FLASH_MCR("false"));
         return t;
     }
 
@@ -1547,14 +1612,16 @@ private:
     char *nullStr()
     {
         char *t = (char *)newP(6);
-        strcpy(t, (const char *)MBSTRING_FLASH_MCR("null"));
+        if (t)
+            strcpy(t, (const char *)MBSTRING_FLASH_MCR("null"));
         return t;
     }
 
     char *pgmStr(PGM_P p)
     {
         char *t = (char *)newP(strlen_P(p));
-        strcpy_P(t, p);
+        if (t)
+            strcpy_P(t, p);
         return t;
     }
 
@@ -1689,25 +1756,38 @@ private:
         concat(cstr, strlen(cstr));
     }
 
+#if MB_STRING_SSO_SIZE > 0
+    bool isInline() const
+    {
+        return buf == sso;
+    }
+#endif
+
     void move(MB_String &rhs)
     {
-        if (buf)
+        if (this == &rhs)
+            return;
+
+#if MB_STRING_SSO_SIZE > 0
+        if (rhs.isInline() || (buf && bufLen >= rhs.bufLen))
+#else
+        if (buf && bufLen >= rhs.bufLen)
+#endif
         {
-            if (bufLen >= rhs.bufLen)
-            {
-                strcpy(buf, rhs.buf);
-                bufLen = rhs.bufLen;
-                rhs.bufLen = 0;
-                return;
-            }
-            else
-            {
-                free(buf);
-            }
+            // the content fits or can't be taken over
+            if (rhs.length() > 0)
+                copy(rhs.buf, rhs.length());
+            else if (buf)
+                buf[0] = '\0';
+            rhs.clear();
+            return;
         }
+
+        allocate(0, false);
         buf = rhs.buf;
         bufLen = rhs.bufLen;
         rhs.buf = NULL;
+        rhs.bufLen = 0;
     }
 
     void allocate(size_t len, bool shrink)
@@ -1715,13 +1795,69 @@ private:
 
         if (len == 0)
         {
+#if MB_STRING_SSO_SIZE > 0
+            if (buf && !isInline())
+#else
             if (buf)
+#endif
                 free(buf);
             buf = NULL;
             bufLen = 0;
             return;
         }
 
+#if MB_STRING_SSO_SIZE > 0
+        if (len <= MB_STRING_SSO_SIZE)
+        {
+            // move the short string into the object
+            if (!isInline())
+            {
+                size_t slen = buf ? strlen(buf) : 0;
+                if (slen > MB_STRING_SSO_SIZE - 1)
+                    slen = MB_STRING_SSO_SIZE - 1;
+                if (buf)
+                {
+                    memcpy(sso, buf, slen);
+                    free(buf);
+                }
+                sso[slen] = '\0';
+                buf = sso;
+                bufLen = MB_STRING_SSO_SIZE;
+            }
+            return;
+        }
+
+        if (isInline())
+        {
+            // grow out of the object, the short string is kept when allocation failed
+            char *tmp = NULL;
+
+#if defined(ESP8266_USE_EXTERNAL_HEAP)
+            ESP.setExternalHeap();
+#endif
+
+#if defined(BOARD_HAS_PSRAM) && defined(MB_STRING_USE_PSRAM)
+            if (ESP.getPsramSize() > 0)
+                tmp = (char *)ps_malloc(len);
+            else
+                tmp = (char *)malloc(len);
+#else
+            tmp = (char *)malloc(len);
+#endif
+
+#if defined(ESP8266_USE_EXTERNAL_HEAP)
+            ESP.resetHeap();
+#endif
+            if (tmp)
+            {
+                memcpy(tmp, sso, MB_STRING_SSO_SIZE);
+                buf = tmp;
+                bufLen = len;
+            }
+            return;
+        }
+#endif
+
         if (len > bufLen || shrink)
         {
 
@@ -1732,17 +1868,22 @@ private:
             if (shrink || (bufLen > 0 && buf))
             {
                 int slen = length();
+                char *tmp = NULL;
 
 #if defined(BOARD_HAS_PSRAM) && defined(MB_STRING_USE_PSRAM)
                 if (ESP.getPsramSize() > 0)
-                    buf = (char *)ps_realloc(buf, len);
+                    tmp = (char *)ps_realloc(buf, len);
                 else
-                    buf = (char *)realloc(buf, len);
+                    tmp = (char *)realloc(buf, len);
 #else
-                buf = (char *)realloc(buf, len);
+                tmp = (char *)realloc(buf, len);
 #endif
-                if (buf)
+                // the old buffer is kept when the reallocation failed
+                if (tmp)
                 {
+                    buf = tmp;
+                    if (slen >= (int)len)
+                        slen = len - 1;
                     buf[slen] = '\0';
                     bufLen = len;
                 }
@@ -1792,7 +1933,23 @@ private:
         if (shrink)
             allocate(newlen, true);
         else if (newlen > bufLen)
-            allocate(newlen, false);
+        {
+            // grow the existing buffer geometrically for the amortized constant time appending
+            if (bufLen > 0)
+            {
+                size_t growth = bufLen / 2;
+#if MB_STRING_MAX_GROWTH > 0
+                if (growth > MB_STRING_MAX_GROWTH)
+                    growth = MB_STRING_MAX_GROWTH;
+#endif
+                if (newlen < bufLen + growth)
+                    allocate(getReservedLen(bufLen + growth - 1), false);
+            }
+
+            // the exact size when growing failed
+            if (newlen > bufLen)
+                allocate(newlen, false);
+        }
 
         return newlen <= bufLen;
     }
@@ -2038,8 +2195,218 @@ private:
 
     char *buf = NULL;
     size_t bufLen = 0;
+#if MB_STRING_SSO_SIZE > 0
+    // the buffer of the short string, buf points to it when it is used
+    char sso[MB_STRING_SSO_SIZE];
+#endif
 };
 
+/* The non-owning view of the characters in the RAM string, it is valid as long as the source is not changed or freed */
+class MB_StringView
+{
+public:
+    MB_StringView() {}
+
+    MB_StringView(const char *cstr) : ptr(cstr), len(cstr ? strlen(cstr) : 0) {}
+
+    MB_StringView(const char *cstr, size_t length) : ptr(cstr), len(cstr ? length : 0) {}
+
+    MB_StringView(const MB_String &str) : ptr(str.c_str()), len(str.length()) {}
+
+    const char *data() const
+    {
+        return ptr;
+    }
+
+    size_t length() const
+    {
+        return len;
+    }
+
+    size_t size() const
+    {
+        return len;
+    }
+
+    bool empty() const
+    {
+        return len == 0;
+    }
+
+    char operator[](size_t index) const
+    {
+        return index < len ? ptr[index] : 0;
+    }
+
+    MB_StringView substr(size_t offset, size_t length = npos) const
+    {
+        if (offset >= len)
+            return MB_StringView();
+
+        if (length > len - offset)
+            length = len - offset;
+
+        return MB_StringView(ptr + offset, length);
+    }
+
+    MB_StringView trim() const
+    {
+        size_t p1 = 0, p2 = len;
+
+        while (p1 < p2 && ptr[p1] <= 32)
+            p1++;
+
+        while (p2 > p1 && ptr[p2 - 1] <= 32)
+            p2--;
+
+        return MB_StringView(ptr + p1, p2 - p1);
+    }
+
+    size_t find(char c, size_t offset = 0) const
+    {
+        if (offset >= len)
+            return npos;
+
+        const char *p = (const char *)memchr(ptr + offset, c, len - offset);
+        return p ? (size_t)(p - ptr) : npos;
+    }
+
+    size_t find(const MB_StringView &s, size_t offset = 0) const
+    {
+        if (s.len == 0 || s.len > len)
+            return npos;
+
+        while ((offset = find(s.ptr[0], offset)) != npos && offset + s.len <= len)
+        {
+            if (memcmp(ptr + offset, s.ptr, s.len) == 0)
+                return offset;
+            offset++;
+        }
+
+        return npos;
+    }
+
+    /* Find the PROGMEM token from offset */
+    size_t findP(PGM_P token, size_t offset = 0) const
+    {
+        size_t tlen = strlen_P(token);
+        if (tlen == 0 || tlen > len)
+            return npos;
+
+        char first = pgm_read_byte(token);
+        while ((offset = find(first, offset)) != npos && offset + tlen <= len)
+        {
+            if (matchP(offset, token, tlen, false))
+                return offset;
+            offset++;
+        }
+
+        return npos;
+    }
+
+    /* Find the last PROGMEM token which its last character is at or before offset, as MB_String::find_last_of */
+    size_t rfindP(PGM_P token, size_t offset = npos) const
+    {
+        size_t tlen = strlen_P(token);
+        if (tlen == 0 || tlen > len)
+            return npos;
+
+        size_t end = offset >= len ? len : offset + 1;
+        while (end >= tlen)
+        {
+            if (matchP(end - tlen, token, tlen, false))
+                return end - tlen;
+            end--;
+        }
+
+        return npos;
+    }
+
+    /* Compare the PROGMEM token with the characters at offset */
+    bool startsWithP(PGM_P token, size_t offset = 0, bool caseInSensitive = false) const
+    {
+        size_t tlen = strlen_P(token);
+        return offset <= len && tlen <= len - offset && matchP(offset, token, tlen, caseInSensitive);
+    }
+
+    bool equalsP(PGM_P token, bool caseInSensitive = false) const
+    {
+        return strlen_P(token) == len && matchP(0, token, len, caseInSensitive);
+    }
+
+    long toInt() const
+    {
+        size_t i = 0;
+        while (i < len && ptr[i] <= 32)
+            i++;
+
+        bool neg = i < len && ptr[i] == '-';
+        if (i < len && (ptr[i] == '-' || ptr[i] == '+'))
+            i++;
+
+        long v = 0;
+        while (i < len && ptr[i] >= '0' && ptr[i] <= '9')
+            v = v * 10 + (ptr[i++] - '0');
+
+        return neg ? -v : v;
+    }
+
+    static const size_t npos = -1;
+
+private:
+    bool matchP(size_t offset, PGM_P token, size_t tlen, bool caseInSensitive) const
+    {
+        for (size_t i = 0; i < tlen; i++)
+        {
+            char a = ptr[offset + i], b = pgm_read_byte(token + i);
+            if (caseInSensitive)
+            {
+                a = tolower(a);
+                b = tolower(b);
+            }
+            if (a != b)
+                return false;
+        }
+        return true;
+    }
+
+    const char *ptr = NULL;
+    size_t len = 0;
+};
+
+inline MB_String::MB_String(const MB_StringView &value)
+{
+    *this = value;
+}
+
+inline MB_String &MB_String::operator=(const MB_StringView &rhs)
+{
+    if (rhs.length() == 0)
+        clear();
+    else if (buf && rhs.data() >= buf && rhs.data() < buf + bufLen)
+    {
+        // the view of this string
+        memmove(buf, rhs.data(), rhs.length());
+        buf[rhs.length()] = '\0';
+    }
+    else
+        copy(rhs.data(), rhs.length());
+    return *this;
+}
+
+inline MB_String &MB_String::operator+=(const MB_StringView &rhs)
+{
+    if (buf && rhs.data() >= buf && rhs.data() < buf + bufLen)
+    {
+        // the view of this string, the buffer may move when it grows
+        MB_String s = rhs;
+        concat(s);
+    }
+    else
+        concat(rhs.data(), rhs.length());
+    return *this;
+}
+
 inline MB_String operator+(const MB_String &lhs, const MB_String &rhs)
 {
     MB_String res;
@@ -34,7 +34,7 @@
 #include "MB_MCU.h"
 
 #define FS_NO_GLOBALS
-#if defined(ESP32) || defined(ESP8266) || defined(MB_ARDUINO_PICO)
+#if defined(ESP32) || defined(ESP8266) || defined(MB_ARDUINO_PICO) || defined(MB_POSIX_HOST)
 #if defined(MBFS_FLASH_FS) || defined(MBFS_SD_FS)
 #include <FS.h>
 #endif
@@ -333,7 +333,7 @@ public:
         flash_rdy = MBFS_FLASH_FS.begin();
 #endif
 
-#elif defined(ESP8266) || defined(MB_ARDUINO_PICO)
+#elif defined(ESP8266) || defined(MB_ARDUINO_PICO) || defined(MB_POSIX_HOST)
         flash_rdy = MBFS_FLASH_FS.begin();
 #endif
 
@@ -43,5 +43,12 @@
 #endif
 #endif
 
+// The native build on POSIX host e.g. Linux gateway with the Arduino API in extras/posix
+#if !defined(ARDUINO) && !defined(ESP32) && !defined(ESP8266) && (defined(__linux__) || defined(__APPLE__))
+#ifndef MB_POSIX_HOST
+#define MB_POSIX_HOST
+#endif
+#endif
+
 
 #endif
\ No newline at end of file
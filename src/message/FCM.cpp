@@ -165,7 +165,7 @@ void FB_CM::fcm_connect(FirebaseData *fbdo, firebase_fcm_msg_mode mode)
     fbdo->session.max_payload_length = 0;
 }
 
-bool FB_CM::sendHeader(FirebaseData *fbdo, firebase_fcm_msg_mode mode, const char *payload)
+bool FB_CM::sendHeader(FirebaseData *fbdo, firebase_fcm_msg_mode mode, const char *payload, bool &payloadSent)
 {
     bool msgMode = (mode == firebase_fcm_msg_mode_legacy_http || mode == firebase_fcm_msg_mode_httpv1);
 
@@ -214,43 +214,16 @@ bool FB_CM::sendHeader(FirebaseData *fbdo, firebase_fcm_msg_mode mode, const cha
 
     Core.hh.addRequestHeaderLast(header);
 
-    Core.hh.addGAPIsHostHeader(header, msgMode ? firebase_fcm_pgm_str_1 /* "fcm" */ : firebase_fcm_pgm_str_2 /* "iid" */);
+    // the custom headers are not used as Core.config is not set in fcm legacy
+    Core.hh.addGAPIsHostHeaderFields(&Core.sh, header, fbdo->session.header_template,
+                                     msgMode ? firebase_fcm_pgm_str_1 /* "fcm" */ : firebase_fcm_pgm_str_2 /* "iid" */,
+                                     MB_String());
 
     // Core.getTokenType() is required as Core.config is not set in fcm legacy
     if (Core.getTokenType() == token_type_oauth2_access_token && mode == firebase_fcm_msg_mode_httpv1)
-    {
-        Core.hh.addAuthHeaderFirst(header, token_type_oauth2_access_token);
-
-        fbdo->tcpSend(header.c_str());
-        header.clear();
-
-        if (fbdo->session.response.code < 0)
-            return false;
-
-        fbdo->tcpSend(Core.getToken());
-
-        if (fbdo->session.response.code < 0)
-            return false;
-    }
+        Core.hh.addAuthHeader(header, token_type_oauth2_access_token, Core.getToken());
     else
-    {
-        Core.hh.addAuthHeaderFirst(header, token_type_undefined);
-
-        fbdo->tcpSend(header.c_str());
-        header.clear();
-
-        if (fbdo->session.response.code < 0)
-            return false;
-
-        fbdo->tcpSend(server_key.c_str());
-
-        if (fbdo->session.response.code < 0)
-            return false;
-    }
-
-    Core.hh.addNewLine(header);
-
-    Core.hh.addUAHeader(header);
+        Core.hh.addAuthHeader(header, token_type_undefined, server_key.c_str());
 
     if (mode != firebase_fcm_msg_mode_app_instance_info)
     {
@@ -266,6 +239,11 @@ bool FB_CM::sendHeader(FirebaseData *fbdo, firebase_fcm_msg_mode mode, const cha
     Core.hh.addConnectionHeader(header, keepAlive);
     Core.hh.addNewLine(header);
 
+    // the header and the small payload are sent in one write
+    payloadSent = strlen(payload) <= FIREBASE_COALESCE_PAYLOAD_SIZE;
+    if (payloadSent)
+        header += payload;
+
     fbdo->tcpSend(header.c_str());
     header.clear();
 
@@ -863,9 +841,10 @@ bool FB_CM::fcm_send(FirebaseData *fbdo, firebase_fcm_msg_mode mode, const char
     // set the SSL client to skip server SSL certificate verification
     fbdo->tcpClient.setCACert(nullptr);
 
-    bool ret = sendHeader(fbdo, mode, msg);
+    bool payloadSent = false;
+    bool ret = sendHeader(fbdo, mode, msg, payloadSent);
 
-    if (ret)
+    if (ret && !payloadSent)
         fbdo->tcpSend(msg);
 
     fbdo->session.fcm.payload.clear();
@@ -907,23 +886,7 @@ bool FB_CM::handleResponse(FirebaseData *fbdo)
     if (!fbdo->waitResponse(tcpHandler))
         return false;
 
-    bool complete = false;
-
-    while (tcpHandler.available() > 0 /* data available to read payload */ ||
-           tcpHandler.payloadRead < response.contentLen /* incomplete content read  */)
-    {
-        if (!fbdo->readResponse(&fbdo->session.fcm.payload, tcpHandler, response) && !response.isChunkedEnc)
-            break;
-
-        // Last chunk?
-        if (Core.ut.isChunkComplete(&tcpHandler, &response, complete))
-            break;
-    }
-
-    // To make sure all chunks read and
-    // ready to send next request
-    if (response.isChunkedEnc)
-        fbdo->tcpClient.flush();
+    fbdo->readResponseBody(&fbdo->session.fcm.payload, tcpHandler, response);
 
     // parse the payload for error
     fbdo->getError(fbdo->session.fcm.payload, tcpHandler, response, false);
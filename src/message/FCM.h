@@ -215,7 +215,7 @@ private:
   void rescon(FirebaseData *fbdo, const char *host);
   void fcm_connect(FirebaseData *fbdo, firebase_fcm_msg_mode mode);
   bool fcm_send(FirebaseData *fbdo, firebase_fcm_msg_mode mode, const char *msg);
-  bool sendHeader(FirebaseData *fbdo, firebase_fcm_msg_mode mode, const char *payload);
+  bool sendHeader(FirebaseData *fbdo, firebase_fcm_msg_mode mode, const char *payload, bool &payloadSent);
   void fcm_prepareLegacyPayload(FCM_Legacy_HTTP_Message *msg);
   void fcm_prepareV1Payload(FCM_HTTPv1_JSON_Message *msg);
   void fcm_preparSubscriptionPayload(const char *topic, const char *IID[], size_t numToken);
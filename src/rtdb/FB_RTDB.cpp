@@ -335,8 +335,8 @@ void FB_RTDB::enableClassicRequest(FirebaseData *fbdo, bool enable)
 }
 
 bool FB_RTDB::buildRequest(FirebaseData *fbdo, firebase_request_method method, MB_StringPtr path,
-                           MB_StringPtr payload, firebase_data_type type, int subtype, uint32_t value_addr,
-                           uint32_t query_addr, uint32_t priority_addr, MB_StringPtr etag, bool async,
+                           MB_StringPtr payload, firebase_data_type type, int subtype, uintptr_t value_addr,
+                           uintptr_t query_addr, uintptr_t priority_addr, MB_StringPtr etag, bool async,
                            bool queue, size_t blob_size, MB_StringPtr filename, firebase_mem_storage_type storage_type,
                            RTDB_DownloadProgressCallback downloadCallback, RTDB_UploadProgressCallback uploadCallback)
 {
@@ -892,7 +892,7 @@ void FB_RTDB::setMaxRetry(FirebaseData *fbdo, uint8_t num)
     fbdo->session.rtdb.max_retry = num;
 }
 
-void FB_RTDB::setBlobRef(FirebaseData *fbdo, int addr)
+void FB_RTDB::setBlobRef(FirebaseData *fbdo, uintptr_t addr)
 {
     if (fbdo->session.rtdb.blob && fbdo->session.rtdb.isBlobPtr)
     {
@@ -1299,16 +1299,16 @@ uint8_t FB_RTDB::readQueueFile(FirebaseData *fbdo, fs::File &file, QueueItem &it
                             item.async = (bool)result.to<int>();
                             break;
                         case 5:
-                            item.address.din = result.to<int>();
+                            item.address.din = result.to<uintptr_t>();
                             break;
                         case 6:
-                            item.address.dout = result.to<int>();
+                            item.address.dout = result.to<uintptr_t>();
                             break;
                         case 7:
-                            item.address.query = result.to<int>();
+                            item.address.query = result.to<uintptr_t>();
                             break;
                         case 8:
-                            item.address.priority = result.to<int>();
+                            item.address.priority = result.to<uintptr_t>();
                             break;
                         case 9:
                             item.blobSize = result.to<int>();
@@ -1381,16 +1381,16 @@ uint8_t FB_RTDB::readQueueFileSdFat(FirebaseData *fbdo, MBFS_SD_FILE &file, Queu
                             item.async = (bool)result.to<int>();
                             break;
                         case 5:
-                            item.address.din = result.to<int>();
+                            item.address.din = result.to<uintptr_t>();
                             break;
                         case 6:
-                            item.address.dout = result.to<int>();
+                            item.address.dout = result.to<uintptr_t>();
                             break;
                         case 7:
-                            item.address.query = result.to<int>();
+                            item.address.query = result.to<uintptr_t>();
                             break;
                         case 8:
-                            item.address.priority = result.to<int>();
+                            item.address.priority = result.to<uintptr_t>();
                             break;
                         case 9:
                             item.blobSize = result.to<int>();
@@ -1640,15 +1640,11 @@ bool FB_RTDB::handleRequest(FirebaseData *fbdo, struct firebase_rtdb_request_inf
         return false;
 #endif
 
-    if (!fbdo->tcpClient.connected())
-        fbdo->session.rtdb.async_count = 0;
-
-    if ((fbdo->session.rtdb.async && !req->async) ||
-        fbdo->session.rtdb.async_count > Core.config->async_close_session_max_request)
-    {
-        fbdo->session.rtdb.async_count = 0;
+    // the connection is reused by the synchronous request when the asynchronous request responses were all read by poll()
+    if (fbdo->session.rtdb.async_count > 0 &&
+        (!fbdo->tcpClient.connected() || (fbdo->session.rtdb.async && !req->async) ||
+         fbdo->session.rtdb.async_count > Core.config->async_close_session_max_request))
         fbdo->closeSession();
-    }
 
     fbdo->session.rtdb.queue_ID = 0;
     if (req->data.etag.length() > 0)
@@ -1666,11 +1662,13 @@ bool FB_RTDB::handleRequest(FirebaseData *fbdo, struct firebase_rtdb_request_inf
     fbdo->session.rtdb.req_data_type = req->data.type;
     fbdo->session.rtdb.data_mismatch = false;
     fbdo->session.rtdb.async = req->async;
-    if (req->async)
-        fbdo->session.rtdb.async_count++;
 
     if (sendRequest(fbdo, req))
     {
+        // the asynchronous request is counted when it was completely sent, as the session
+        // can be closed (and its pending requests reported) before sending
+        if (req->async)
+            fbdo->session.rtdb.async_count++;
 
         if (req->method == rtdb_stream)
         {
@@ -1914,6 +1912,7 @@ bool FB_RTDB::sendRequest(FirebaseData *fbdo, struct firebase_rtdb_request_info_
     int len = 0;
     size_t toRead = 0;
     bool ret = false;
+    bool payloadSent = false;
 
     rescon(fbdo, Core.config->database_url.c_str(), req);
 
@@ -1956,7 +1955,7 @@ bool FB_RTDB::sendRequest(FirebaseData *fbdo, struct firebase_rtdb_request_info_
         req->method != rtdb_restore &&
         req->data.type != d_file &&
         req->data.type != d_file_ota)
-        ret = sendRequestHeader(fbdo, req);
+        ret = sendRequestHeader(fbdo, req, payloadSent);
     else
     {
 
@@ -1986,7 +1985,7 @@ bool FB_RTDB::sendRequest(FirebaseData *fbdo, struct firebase_rtdb_request_info_
             }
         }
 
-        ret = sendRequestHeader(fbdo, req);
+        ret = sendRequestHeader(fbdo, req, payloadSent);
     }
 
     if (req->method == rtdb_get_nocontent ||
@@ -2016,7 +2015,11 @@ bool FB_RTDB::sendRequest(FirebaseData *fbdo, struct firebase_rtdb_request_info_
     fbdo->tcpClient.dataTime = 0;
 
     // Send payload
-    if (req->data.address.din > 0 && req->data.type == d_json)
+    if (payloadSent)
+    {
+        // the payload was sent with the header
+    }
+    else if (req->data.address.din > 0 && req->data.type == d_json)
     {
         FirebaseJson *json = addrTo<FirebaseJson *>(req->data.address.din);
         if (json)
@@ -2370,7 +2373,6 @@ waits:
                 tcpHandler.error.code = 0;
 
                 int bufLen = tcpHandler.chunkBufSize;
-                uint8_t *buf = reinterpret_cast<uint8_t *>(Core.mbfs.newP(bufLen, false));
 
                 int stage = 0;
                 bool downloaded = false;
@@ -2379,7 +2381,7 @@ waits:
                                                                           strlen_P(firebase_rtdb_pgm_str_8 /* "\"file,base64," */)
                                                                     : pChunkSize;
 
-                while (fbdo->processDownload(req->filename, (firebase_mem_storage_type)req->storageType, buf, bufLen,
+                while (fbdo->processDownload(req->filename, (firebase_mem_storage_type)req->storageType, bufLen,
                                              tcpHandler, response, stage, tcpHandler.downloadOTA))
                 {
                     downloaded = true;
@@ -2407,8 +2409,6 @@ waits:
                                                                         : pChunkSize;
                 }
 
-                Core.mbfs.delP(&buf);
-
                 if (downloaded)
                     reportDownloadProgress(fbdo, req, tcpHandler.payloadRead);
 
@@ -2437,6 +2437,8 @@ waits:
                 {
 
                     FBUtils::idle();
+                    if (tcpHandler.pChunkIdx == 1)
+                        Core.hh.reservePayload(payload, response);
                     payload += pChunk;
 
                     // early parsing currently available http response for data types, event types, and event data
@@ -2763,15 +2765,19 @@ void FB_RTDB::sendCB(FirebaseData *fbdo)
 
         fbdo->initJson();
 
+        // the stream data keeps the text, the payload buffer is moved to the json object
+        // which is parsed in it
+        s.sif->data = fbdo->session.rtdb.raw.c_str();
+
         if (fbdo->session.rtdb.resp_data_type == d_json)
         {
-            fbdo->session.jsonPtr->setJsonData(fbdo->session.rtdb.raw.c_str());
+            fbdo->session.jsonPtr->moveJsonDataInSitu(fbdo->session.rtdb.raw);
             fbdo->session.arrPtr->clear();
         }
 
         if (fbdo->session.rtdb.resp_data_type == d_array)
         {
-            fbdo->session.arrPtr->setJsonArrayData(fbdo->session.rtdb.raw.c_str());
+            fbdo->session.arrPtr->moveJsonArrayDataInSitu(fbdo->session.rtdb.raw);
             fbdo->session.jsonPtr->clear();
         }
 
@@ -2779,7 +2785,6 @@ void FB_RTDB::sendCB(FirebaseData *fbdo)
         s.arrPtr = fbdo->session.arrPtr;
 
         s.sif->stream_path = fbdo->session.rtdb.stream_path.c_str();
-        s.sif->data = fbdo->session.rtdb.raw.c_str();
         s.sif->path = fbdo->session.rtdb.path.c_str();
         s.sif->payload_length = fbdo->session.payload_length;
         s.sif->max_payload_length = fbdo->session.max_payload_length;
@@ -2818,8 +2823,9 @@ void FB_RTDB::sendCB(FirebaseData *fbdo)
         if (!fbdo->session.jsonPtr)
             fbdo->session.jsonPtr = new FirebaseJson();
 
+        // parsed in the payload buffer which is moved to the json object
         if (fbdo->session.rtdb.resp_data_type == d_json)
-            fbdo->session.jsonPtr->setJsonData(fbdo->session.rtdb.raw.c_str());
+            fbdo->session.jsonPtr->moveJsonDataInSitu(fbdo->session.rtdb.raw);
 
         if (s.sif->data_type == d_json)
             s.sif->m_json = fbdo->session.jsonPtr;
@@ -3155,7 +3161,37 @@ bool FB_RTDB::hasPayload(struct firebase_rtdb_request_info_t *req)
     return getHTTPMethod(req) == http_put || getHTTPMethod(req) == http_post || getHTTPMethod(req) == http_patch;
 }
 
-bool FB_RTDB::sendRequestHeader(FirebaseData *fbdo, struct firebase_rtdb_request_info_t *req)
+bool FB_RTDB::addPayload(struct firebase_rtdb_request_info_t *req, MB_String &buf)
+{
+    if (req->data.address.din > 0 && req->data.type == d_json)
+    {
+        FirebaseJson *json = addrTo<FirebaseJson *>(req->data.address.din);
+        if (json)
+            buf += json->raw();
+        return true;
+    }
+
+    if (req->payload.length() > 0 || (req->data.type == d_array && req->data.address.din > 0))
+    {
+        buf += req->pre_payload;
+
+        if (req->data.type == d_array && req->data.address.din > 0)
+        {
+            FirebaseJsonArray *arr = addrTo<FirebaseJsonArray *>(req->data.address.din);
+            if (arr)
+                buf += arr->raw();
+        }
+        else
+            buf += req->payload;
+
+        buf += req->post_payload;
+        return true;
+    }
+
+    return false;
+}
+
+bool FB_RTDB::sendRequestHeader(FirebaseData *fbdo, struct firebase_rtdb_request_info_t *req, bool &payloadSent)
 {
     firebase_request_method http_method = getHTTPMethod(req);
     fbdo->session.rtdb.shallow_flag = false;
@@ -3203,19 +3239,10 @@ bool FB_RTDB::sendRequestHeader(FirebaseData *fbdo, struct firebase_rtdb_request
     {
         header += firebase_rtdb_pgm_str_18; // ".json"
         if (Core.getTokenType() != token_type_oauth2_access_token && !Core.config->signer.test_mode)
+        {
             Core.uh.addParam(header, firebase_rtdb_pgm_str_19 /* "auth=" */, "", hasQueryParams, true);
-
-        fbdo->tcpSend(header.c_str());
-        header.clear();
-
-        if (fbdo->session.response.code < 0)
-            return false;
-
-        if (Core.getTokenType() != token_type_oauth2_access_token && !Core.config->signer.test_mode)
-            fbdo->tcpSend(Core.internal.auth_token.c_str());
-
-        if (fbdo->session.response.code < 0)
-            return false;
+            header += Core.internal.auth_token;
+        }
     }
 
     if (fbdo->session.rtdb.read_tmo > 0)
@@ -3259,9 +3286,8 @@ bool FB_RTDB::sendRequestHeader(FirebaseData *fbdo, struct firebase_rtdb_request
         Core.uh.addParam(header, firebase_rtdb_pgm_str_29 /* "print=silent" */, "", hasQueryParams, true);
 
     Core.hh.addRequestHeaderLast(header);
-    Core.hh.addHostHeader(header, Core.config->database_url.c_str());
-    Core.hh.addUAHeader(header);
-    Core.hh.getCustomHeaders(&Core.sh, header, Core.config->signer.customHeaders);
+    Core.hh.addHostHeaderFields(&Core.sh, header, fbdo->session.header_template,
+                                Core.config->database_url.c_str(), Core.config->signer.customHeaders);
 
     if (Core.getTokenType() == token_type_oauth2_access_token)
     {
@@ -3271,17 +3297,7 @@ bool FB_RTDB::sendRequestHeader(FirebaseData *fbdo, struct firebase_rtdb_request
             Core.config->signer.tokens.auth_type[Core.config->signer.tokens.auth_type.length() - 1] != ' ')
             header += firebase_pgm_str_9; // " "
 
-        fbdo->tcpSend(header.c_str());
-        header.clear();
-
-        if (fbdo->session.response.code < 0)
-            return false;
-
-        fbdo->tcpSend(Core.internal.auth_token.c_str());
-
-        if (fbdo->session.response.code < 0)
-            return false;
-
+        header += Core.internal.auth_token;
         Core.hh.addNewLine(header);
     }
 
@@ -3332,11 +3348,16 @@ bool FB_RTDB::sendRequestHeader(FirebaseData *fbdo, struct firebase_rtdb_request
     if (req->method == rtdb_get_priority || req->method == rtdb_set_priority)
         fbdo->session.rtdb.priority_val_flag = true;
 
+    int payloadLen = hasPayload(req) ? getPayloadLen(req) : 0;
+
     if (hasPayload(req))
-        Core.hh.addContentLengthHeader(header, getPayloadLen(req));
+        Core.hh.addContentLengthHeader(header, payloadLen);
 
     Core.hh.addNewLine(header);
 
+    // the header and the small payload are sent in one write
+    payloadSent = payloadLen <= FIREBASE_COALESCE_PAYLOAD_SIZE && addPayload(req, header);
+
     fbdo->tcpSend(header.c_str());
     header.clear();
 
@@ -1608,6 +1608,31 @@ public:
                         _NO_ASYNC, _NO_QUEUE, _NO_BLOB_SIZE, toStringPtr(_NO_FILE));
   }
 
+  /** Read (get) the JSON object at the defined node into the struct that declared with FIREBASE_JSON_BIND.
+   *
+   * @param fbdo The pointer to Firebase Data Object.
+   * @param path The path to the node.
+   * @param target The pointer to the bound struct to store the value.
+   * @return Boolean value, indicates the success of the operation.
+   *
+   * @note The payload is deserialized in a single pass without building the FirebaseJson object.
+   * The members that are not in the payload are left unchanged and the null payload leaves the struct unchanged.
+   */
+  template <typename T = const char *, typename S>
+  auto get(FirebaseData *fbdo, T path, S *target) -> typename enable_if<fb_js_bind::is_bound<S>::value, bool>::type
+  {
+    if (!target || !buildRequest(fbdo, http_get, toStringPtr(path), toStringPtr(_NO_PAYLOAD),
+                                 d_json, _NO_SUB_TYPE, _NO_REF, _NO_QUERY, _NO_PRIORITY, toStringPtr(_NO_ETAG),
+                                 _NO_ASYNC, _NO_QUEUE, _NO_BLOB_SIZE, toStringPtr(_NO_FILE)))
+      return false;
+
+    if (fbdo->session.rtdb.resp_data_type == d_null)
+      return true;
+
+    return fbdo->session.rtdb.resp_data_type == d_json &&
+           fb_js_bind::fromString(*target, fbdo->session.rtdb.raw.c_str(), fbdo->session.rtdb.raw.length());
+  }
+
   /** Read (get) the integer value at the defined node.
    *
    * @param fbdo The pointer to Firebase Data Object.
@@ -2599,7 +2624,8 @@ private:
   int preRequestCheck(FirebaseData *fbdo, struct firebase_rtdb_request_info_t *req);
   firebase_request_method getHTTPMethod(firebase_rtdb_request_info_t *req);
   bool hasPayload(struct firebase_rtdb_request_info_t *req);
-  bool sendRequestHeader(FirebaseData *fbdo, struct firebase_rtdb_request_info_t *req);
+  bool addPayload(struct firebase_rtdb_request_info_t *req, MB_String &buf);
+  bool sendRequestHeader(FirebaseData *fbdo, struct firebase_rtdb_request_info_t *req, bool &payloadSent);
   int getPayloadLen(firebase_rtdb_request_info_t *req);
   bool waitResponse(FirebaseData *fbdo, firebase_rtdb_request_info_t *req);
   bool handleResponse(FirebaseData *fbdo, firebase_rtdb_request_info_t *req);
@@ -2613,7 +2639,7 @@ private:
                           firebase_mem_storage_type storageType, struct firebase_rtdb_request_info_t *req);
   void setPtrValue(FirebaseData *fbdo, struct firebase_rtdb_request_info_t *req);
   bool buildRequest(FirebaseData *fbdo, firebase_request_method method, MB_StringPtr path, MB_StringPtr payload,
-                    firebase_data_type type, int subtype, uint32_t value_addr, uint32_t query_addr, uint32_t priority_addr,
+                    firebase_data_type type, int subtype, uintptr_t value_addr, uintptr_t query_addr, uintptr_t priority_addr,
                     MB_StringPtr etag, bool async, bool queue, size_t blob_size, MB_StringPtr filename,
                     firebase_mem_storage_type storage_type = mem_storage_type_undefined,
                     RTDB_DownloadProgressCallback downloadCallback = NULL, RTDB_UploadProgressCallback uploadCallback = NULL);
@@ -2635,7 +2661,7 @@ private:
   bool mRestoreErrorQueue(FirebaseData *fbdo, MB_StringPtr filename, firebase_mem_storage_type storageType);
   bool mDeleteStorageFile(MB_StringPtr filename, firebase_mem_storage_type storageType);
   bool mSaveErrorQueue(FirebaseData *fbdo, MB_StringPtr filename, firebase_mem_storage_type storageType);
-  void setBlobRef(FirebaseData *fbdo, int addr);
+  void setBlobRef(FirebaseData *fbdo, uintptr_t addr);
   void mSetwriteSizeLimit(FirebaseData *fbdo, MB_StringPtr size);
   bool mGetRules(FirebaseData *fbdo, firebase_mem_storage_type storageType, MB_StringPtr filename,
                  RTDB_DownloadProgressCallback callback = NULL);
@@ -2716,12 +2742,12 @@ protected:
     }
   }
 
-  uint32_t getAddr(QueryFilter *v) { return reinterpret_cast<uint32_t>(v); }
-  uint32_t getAddr(FirebaseJson *v) { return reinterpret_cast<uint32_t>(v); }
-  uint32_t getAddr(FirebaseJsonArray *v) { return reinterpret_cast<uint32_t>(v); }
+  uintptr_t getAddr(QueryFilter *v) { return reinterpret_cast<uintptr_t>(v); }
+  uintptr_t getAddr(FirebaseJson *v) { return reinterpret_cast<uintptr_t>(v); }
+  uintptr_t getAddr(FirebaseJsonArray *v) { return reinterpret_cast<uintptr_t>(v); }
 
   template <typename T1, typename T2>
-  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, bool async) ->
+  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, bool async) ->
       typename enable_if<is_string<T1>::value && is_num_int<T2>::value, bool>::type
   {
     return buildRequest(fbdo, http_post, toStringPtr(path), toStringPtr(value, -1), d_integer,
@@ -2730,7 +2756,7 @@ protected:
   }
 
   template <typename T1, typename T2>
-  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, bool async) ->
+  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, bool async) ->
       typename enable_if<is_string<T1>::value && is_bool<T2>::value, bool>::type
   {
     return buildRequest(fbdo, http_post, toStringPtr(path), toStringPtr(value, -1), d_boolean,
@@ -2739,7 +2765,7 @@ protected:
   }
 
   template <typename T1, typename T2>
-  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, bool async) ->
+  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, bool async) ->
       typename enable_if<is_string<T1>::value && is_same<T2, float>::value, bool>::type
   {
     return bbuildRequestEQ(fbdo, http_post, toStringPtr(path), toStringPtr(value, -1), d_float,
@@ -2748,7 +2774,7 @@ protected:
   }
 
   template <typename T1, typename T2>
-  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, bool async) ->
+  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, bool async) ->
       typename enable_if<is_string<T1>::value && is_same<T2, double>::value, bool>::type
   {
     return buildRequest(fbdo, http_post, toStringPtr(path), toStringPtr(value, -1), d_double,
@@ -2757,7 +2783,7 @@ protected:
   }
 
   template <typename T1, typename T2>
-  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, bool async) ->
+  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, bool async) ->
       typename enable_if<is_string<T1>::value && is_string<T2>::value, bool>::type
   {
     return buildRequest(fbdo, http_post, toStringPtr(path), toStringPtr(value), d_string,
@@ -2766,7 +2792,7 @@ protected:
   }
 
   template <typename T1, typename T2>
-  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 json, int priority_addr, bool async) ->
+  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 json, uintptr_t priority_addr, bool async) ->
       typename enable_if<is_string<T1>::value && is_same<T2, FirebaseJson *>::value, bool>::type
   {
     return buildRequest(fbdo, http_post, toStringPtr(path), toStringPtr(_NO_PAYLOAD), d_json,
@@ -2775,7 +2801,7 @@ protected:
   }
 
   template <typename T1, typename T2>
-  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 arr, int priority_addr, bool async) ->
+  auto dataPushHandler(FirebaseData *fbdo, T1 path, T2 arr, uintptr_t priority_addr, bool async) ->
       typename enable_if<is_string<T1>::value && is_same<T2, FirebaseJsonArray *>::value, bool>::type
   {
     return buildRequest(fbdo, http_post, toStringPtr(path), toStringPtr(_NO_PAYLOAD), d_array,
@@ -2802,7 +2828,7 @@ protected:
   }
 
   template <typename T1, typename T2, typename T3>
-  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, T3 etag, bool async) ->
+  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, T3 etag, bool async) ->
       typename enable_if<is_string<T1>::value && is_bool<T2>::value, bool>::type
   {
     return buildRequest(fbdo, http_put, toStringPtr(path), toStringPtr(value, -1), d_boolean,
@@ -2811,7 +2837,7 @@ protected:
   }
 
   template <typename T1, typename T2, typename T3>
-  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, T3 etag, bool async) ->
+  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, T3 etag, bool async) ->
       typename enable_if<is_string<T1>::value && is_num_int<T2>::value, bool>::type
   {
     return buildRequest(fbdo, http_put, toStringPtr(path), toStringPtr(value, -1), d_integer,
@@ -2820,7 +2846,7 @@ protected:
   }
 
   template <typename T1, typename T2, typename T3>
-  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, T3 etag, bool async) ->
+  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, T3 etag, bool async) ->
       typename enable_if<is_string<T1>::value && is_same<T2, float>::value, bool>::type
   {
     return buildRequest(fbdo, http_put, toStringPtr(path), toStringPtr(value, -1), d_float,
@@ -2829,7 +2855,7 @@ protected:
   }
 
   template <typename T1, typename T2, typename T3>
-  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, T3 etag, bool async) ->
+  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, T3 etag, bool async) ->
       typename enable_if<is_string<T1>::value && is_same<T2, double>::value, bool>::type
   {
     return buildRequest(fbdo, http_put, toStringPtr(path), toStringPtr(value, -1), d_double,
@@ -2838,7 +2864,7 @@ protected:
   }
 
   template <typename T1, typename T2, typename T3>
-  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, int priority_addr, T3 etag, bool async) ->
+  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 value, uintptr_t priority_addr, T3 etag, bool async) ->
       typename enable_if<is_string<T1>::value && is_string<T2>::value, bool>::type
   {
     return buildRequest(fbdo, http_put, toStringPtr(path), toStringPtr(value), d_string,
@@ -2847,7 +2873,7 @@ protected:
   }
 
   template <typename T1, typename T2, typename T3>
-  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 json, int priority_addr, T3 etag, bool async) ->
+  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 json, uintptr_t priority_addr, T3 etag, bool async) ->
       typename enable_if<is_string<T1>::value && is_same<T2, FirebaseJson *>::value, bool>::type
   {
     return buildRequest(fbdo, http_put, toStringPtr(path), toStringPtr(_NO_PAYLOAD), d_json,
@@ -2856,7 +2882,7 @@ protected:
   }
 
   template <typename T1, typename T2, typename T3>
-  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 arr, int priority_addr, T3 etag, bool async) ->
+  auto dataSetHandler(FirebaseData *fbdo, T1 path, T2 arr, uintptr_t priority_addr, T3 etag, bool async) ->
       typename enable_if<is_string<T1>::value && is_same<T2, FirebaseJsonArray *>::value, bool>::type
   {
     return buildRequest(fbdo, http_put, toStringPtr(path), toStringPtr(_NO_PAYLOAD), d_array,
@@ -2864,6 +2890,21 @@ protected:
                         _NO_BLOB_SIZE, toStringPtr(_NO_FILE));
   }
 
+  // The struct that declared with FIREBASE_JSON_BIND is serialized as JSON payload without building FirebaseJson object.
+  template <typename T1, typename S, typename T3>
+  auto dataSetHandler(FirebaseData *fbdo, T1 path, S *obj, uintptr_t priority_addr, T3 etag, bool async) ->
+      typename enable_if<is_string<T1>::value && fb_js_bind::is_bound<S>::value, bool>::type
+  {
+    if (!obj)
+      return false;
+
+    MB_String payload;
+    fb_js_bind::toString(payload, *obj);
+    return buildRequest(fbdo, http_put, toStringPtr(path), toStringPtr(payload), d_json,
+                        _NO_SUB_TYPE, _NO_REF, _NO_QUERY, priority_addr, toStringPtr(etag), async, _NO_QUEUE,
+                        _NO_BLOB_SIZE, toStringPtr(_NO_FILE));
+  }
+
   template <typename T1, typename T2>
   auto dataSetHandler(FirebaseData *fbdo, T1 path, uint8_t *blob, size_t size, T2 etag, bool async) ->
       typename enable_if<is_string<T1>::value, bool>::type
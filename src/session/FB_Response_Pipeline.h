@@ -0,0 +1,362 @@
+/**
+ * Firebase response body pipeline, FB_Response_Pipeline.h version 1.0.0
+ *
+ * Created October 19, 2026
+ *
+ * The response body is read from the receive buffer of the client, decoded by the transfer encoding
+ * and written to the sink without the intermediate buffer.
+ * The sinks are chained e.g. the inflate or base64 sink decodes the data and writes the decoded data
+ * to the string, file, OTA or callback sink.
+ *
+ * The MIT License (MIT)
+ * Copyright (c) 2023 K. Suwatchai (Mobizt)
+ *
+ *
+ * Permission is hereby granted, free of charge, to any person returning a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIREBASE_RESPONSE_PIPELINE_H
+#define FIREBASE_RESPONSE_PIPELINE_H
+
+#include <Arduino.h>
+#include "./FB_Const.h"
+#include "./client/FB_Buffered_Client.h"
+
+// The result of Firebase_Response_Pipeline::read when the last chunk was read
+#define FIREBASE_RESPONSE_BODY_END -1
+// The result of Firebase_Response_Pipeline::read when the chunked data is invalid or the sink failed,
+// the error code is set to the response handler
+#define FIREBASE_RESPONSE_BODY_ERROR -2
+
+/* The destination of the response body data */
+class Firebase_Response_Sink
+{
+public:
+    virtual ~Firebase_Response_Sink() {}
+
+    /* Write the body data, return false when the data can't be written */
+    virtual bool write(const char *data, size_t len) = 0;
+
+    /* The error code when the data can't be written */
+    virtual int errorCode() { return FIREBASE_ERROR_TCP_RESPONSE_PAYLOAD_DECODE_FAILED; }
+};
+
+/* Append the body data to string */
+class Firebase_String_Sink : public Firebase_Response_Sink
+{
+public:
+    Firebase_String_Sink(MB_String &out) : out(out) {}
+
+    bool write(const char *data, size_t len)
+    {
+        out += MB_StringView(data, len);
+        return true;
+    }
+
+private:
+    MB_String &out;
+};
+
+/* Copy the body data to the fixed size buffer */
+class Firebase_Buffer_Sink : public Firebase_Response_Sink
+{
+public:
+    Firebase_Buffer_Sink(uint8_t *buf, size_t size) : buf(buf), size(size) {}
+
+    bool write(const char *data, size_t len)
+    {
+        if (len > size - used)
+            return false;
+
+        memcpy(buf + used, data, len);
+        used += len;
+        return true;
+    }
+
+    size_t length() const
+    {
+        return used;
+    }
+
+private:
+    uint8_t *buf = nullptr;
+    size_t size = 0;
+    size_t used = 0;
+};
+
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+/* Decode the compressed body data and write the decoded data to the next sink */
+class Firebase_Inflate_Sink : public Firebase_Response_Sink
+{
+public:
+    Firebase_Inflate_Sink(Firebase_Inflate *inflate, Firebase_Response_Sink *next) : inflate(inflate), next(next) {}
+
+    bool write(const char *data, size_t len)
+    {
+        MB_StringView in(data, len);
+
+        // the window can be filled before all input was decoded
+        while (inflate && !inflate->error())
+        {
+            MB_StringView out;
+            size_t consumed = inflate->decode(in, out);
+            in = in.substr(consumed);
+
+            if (out.length() > 0)
+            {
+                if (next && !next->write(out.data(), out.length()))
+                {
+                    code = next->errorCode();
+                    return false;
+                }
+            }
+            else if (consumed == 0)
+                break;
+        }
+
+        return inflate && !inflate->error();
+    }
+
+    int errorCode() { return code; }
+
+private:
+    Firebase_Inflate *inflate = nullptr;
+    Firebase_Response_Sink *next = nullptr;
+    int code = FIREBASE_ERROR_TCP_RESPONSE_PAYLOAD_DECODE_FAILED;
+};
+#endif
+
+/* Decode the base64 encoded body data e.g. the file data in the RTDB and write the decoded data to the next sink */
+class Firebase_Base64_Sink : public Firebase_Response_Sink
+{
+public:
+    Firebase_Base64_Sink(Firebase_Base64_Decoder *decoder, Firebase_Response_Sink *next) : decoder(decoder), next(next) {}
+
+    bool write(const char *data, size_t len)
+    {
+        MB_StringView in(data, len);
+        uint8_t out[192];
+
+        // the data after the end of encoded string is ignored
+        while (decoder && !decoder->error() && !decoder->done() && in.length() > 0)
+        {
+            size_t n = 0;
+            in = in.substr(decoder->decode(in, out, sizeof(out), n));
+
+            if (n > 0 && next && !next->write((const char *)out, n))
+            {
+                code = next->errorCode();
+                return false;
+            }
+        }
+
+        return decoder && !decoder->error();
+    }
+
+    int errorCode() { return code; }
+
+private:
+    Firebase_Base64_Decoder *decoder = nullptr;
+    Firebase_Response_Sink *next = nullptr;
+    int code = FIREBASE_ERROR_TCP_RESPONSE_PAYLOAD_DECODE_FAILED;
+};
+
+/* Write the body data to the file that was created by FirebaseData::prepareDownload */
+class Firebase_File_Sink : public Firebase_Response_Sink
+{
+public:
+    Firebase_File_Sink(MB_FS *mbfs, const MB_String &filename, mbfs_file_type type) : mbfs(mbfs), filename(filename), type(type) {}
+
+    ~Firebase_File_Sink()
+    {
+#if defined(ESP32_GT_2_0_1_FS_MEMORY_FIX)
+        // We close file here after append
+        if (opened)
+            mbfs->close(type);
+#endif
+    }
+
+    bool write(const char *data, size_t len)
+    {
+        if (!mbfs)
+            return false;
+
+#if defined(ESP32_GT_2_0_1_FS_MEMORY_FIX)
+        // We open file to append here
+        if (!opened)
+        {
+            int ret = mbfs->open(filename, type, mb_fs_open_mode_append);
+            if (ret < 0)
+            {
+                code = ret;
+                return false;
+            }
+            opened = true;
+        }
+#endif
+
+        if (mbfs->write(type, (uint8_t *)data, len) == (int)len)
+            return true;
+
+        code = MB_FS_ERROR_FILE_IO_ERROR;
+#if !defined(ESP32_GT_2_0_1_FS_MEMORY_FIX)
+        mbfs->close(type);
+#endif
+        return false;
+    }
+
+    int errorCode() { return code; }
+
+private:
+    MB_FS *mbfs = nullptr;
+    const MB_String &filename;
+    mbfs_file_type type;
+    int code = MB_FS_ERROR_FILE_IO_ERROR;
+#if defined(ESP32_GT_2_0_1_FS_MEMORY_FIX)
+    bool opened = false;
+#endif
+};
+
+#if defined(OTA_UPDATE_ENABLED) && (defined(ESP32) || defined(ESP8266) || defined(MB_ARDUINO_PICO))
+/* Write the body data to the firmware update that was started by FirebaseData::prepareDownloadOTA */
+class Firebase_OTA_Sink : public Firebase_Response_Sink
+{
+public:
+    bool write(const char *data, size_t len)
+    {
+        return Update.write((uint8_t *)data, len) == len;
+    }
+
+    int errorCode() { return FIREBASE_ERROR_FW_UPDATE_WRITE_FAILED; }
+};
+#endif
+
+/* Pass the body data as text to the response callback, and write it to the next sink if any */
+class Firebase_Callback_Sink : public Firebase_Response_Sink
+{
+public:
+    Firebase_Callback_Sink(FB_ResponseCallback callback, Firebase_Response_Sink *next = nullptr) : callback(callback), next(next) {}
+
+    bool write(const char *data, size_t len)
+    {
+        if (callback)
+        {
+            // the callback takes the zero terminated string
+            text.clear();
+            text += MB_StringView(data, len);
+            callback(text.c_str());
+        }
+
+        if (next && !next->write(data, len))
+        {
+            code = next->errorCode();
+            return false;
+        }
+
+        return true;
+    }
+
+    int errorCode() { return code; }
+
+private:
+    FB_ResponseCallback callback = nullptr;
+    Firebase_Response_Sink *next = nullptr;
+    MB_String text;
+    int code = FIREBASE_ERROR_TCP_RESPONSE_PAYLOAD_DECODE_FAILED;
+};
+
+class Firebase_Response_Pipeline
+{
+public:
+    Firebase_Response_Pipeline(Firebase_Response_Sink *sink) : sink(sink) {}
+
+    /**
+     * Read the available body data from the receive buffer of client to the sink.
+     * @param client The client.
+     * @param tcpHandler The response handler which keeps the chunked decoder state.
+     * @param chunked The body is chunked transfer encoded.
+     * @param maxLen The maximum number of body bytes to read.
+     * @param line Stop after new line e.g. for event stream, only for the body without transfer encoding.
+     * @return The number of body bytes written to the sink, FIREBASE_RESPONSE_BODY_END when the last chunk was read
+     * or FIREBASE_RESPONSE_BODY_ERROR when the chunked data is invalid or the sink failed.
+     */
+    int read(Firebase_Buffered_Client *client, struct firebase_tcp_response_handler_t &tcpHandler,
+             bool chunked, size_t maxLen, bool line = false)
+    {
+        if (!client)
+            return 0;
+
+        size_t total = 0;
+
+        while (total < maxLen && !tcpHandler.chunkState.error() && !(chunked && tcpHandler.chunkState.done()))
+        {
+            MB_StringView in = client->peekBuffer();
+            if (in.empty())
+                break;
+
+            MB_StringView data;
+            size_t consumed = 0;
+
+            if (chunked)
+                consumed = tcpHandler.chunkState.decode(in, data, maxLen - total);
+            else
+            {
+                data = in.substr(0, maxLen - total);
+                if (line)
+                {
+                    size_t p = data.find('\n');
+                    if (p != MB_StringView::npos)
+                        data = data.substr(0, p + 1);
+                }
+                consumed = data.length();
+            }
+
+            client->consume(consumed);
+
+            if (data.length() > 0)
+            {
+                if (sink && !sink->write(data.data(), data.length()))
+                {
+                    tcpHandler.error.code = sink->errorCode();
+                    return FIREBASE_RESPONSE_BODY_ERROR;
+                }
+
+                total += data.length();
+
+                if (line && data[data.length() - 1] == '\n')
+                    break;
+            }
+        }
+
+        if (total == 0 && chunked && tcpHandler.chunkState.error())
+        {
+            tcpHandler.error.code = FIREBASE_ERROR_TCP_RESPONSE_CHUNKED_DATA_INVALID;
+            return FIREBASE_RESPONSE_BODY_ERROR;
+        }
+
+        if (total == 0 && chunked && tcpHandler.chunkState.done())
+            return FIREBASE_RESPONSE_BODY_END;
+
+        return total;
+    }
+
+private:
+    Firebase_Response_Sink *sink = nullptr;
+};
+
+#endif
@@ -598,6 +598,152 @@ bool FirebaseData::httpConnected()
     return tcpClient.connected();
 }
 
+#if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
+void FirebaseData::setAsyncResultCallback(RTDB_AsyncResultCallback callback)
+{
+    _asyncResultCallback = callback;
+}
+
+size_t FirebaseData::poll()
+{
+    if (session.rtdb.async_count > 0 && session.con_mode != firebase_con_mode_rtdb_stream)
+    {
+        if (tcpClient.connected())
+            readAsync();
+        else
+            closeSession();
+    }
+
+    // the results of the lost requests that were queued by closeSession() are also sent here
+    sendAsyncResults();
+
+    return session.rtdb.async_count;
+}
+
+void FirebaseData::readAsync()
+{
+    firebase_rtdb_async_response_t &async = _asyncState;
+
+    // the responses are read in the order of the requests
+    while (session.rtdb.async_count > 0)
+    {
+        if (async.state == firebase_rtdb_async_state_payload)
+        {
+            int ret = readAsyncPayload();
+            if (ret == 0)
+                break;
+
+            // the rest of the responses can't be found when the payload can't be decoded
+            if (ret < 0)
+            {
+                session.response.code = async.handler.error.code;
+                size_t pending = --session.rtdb.async_count;
+                completeAsync(async.handler.error.code, ++session.rtdb.async_read, pending);
+                closeSession();
+                return;
+            }
+
+            size_t pending = --session.rtdb.async_count;
+            completeAsync(async.response.httpCode, ++session.rtdb.async_read, pending);
+            continue;
+        }
+
+        if (tcpClient.readLine(async.handler.headerLine) <= 0 ||
+            async.handler.headerLine[async.handler.headerLine.length() - 1] != '\n')
+            break;
+
+        MB_StringView line = async.handler.headerLine;
+
+        if (async.state == firebase_rtdb_async_state_status_line)
+        {
+            int pos = 0;
+            async.response.httpCode = Core.hh.getStatusCode(&Core.sh, line, pos);
+            if (async.response.httpCode <= 0)
+            {
+                closeSession();
+                return;
+            }
+            async.state = firebase_rtdb_async_state_headers;
+        }
+        else if (line.trim().empty())
+        {
+            async.state = firebase_rtdb_async_state_payload;
+            async.handler.headerEnded = true;
+            Core.hh.parseRespHeaderEnd(async.response);
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+            Core.hh.initInflate(&Core.sh, async.handler, async.response);
+#endif
+        }
+        else
+            Core.hh.parseRespHeaderLine(&Core.sh, line, async.response);
+
+        async.handler.headerLine.clear();
+    }
+}
+
+int FirebaseData::readAsyncPayload()
+{
+    firebase_rtdb_async_response_t &async = _asyncState;
+    bool chunked = async.response.isChunkedEnc;
+
+    if (async.response.noContent || (!chunked && async.handler.payloadRead >= async.response.contentLen))
+        return 1;
+
+    MB_String buf;
+    Firebase_String_Sink sink(buf);
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+    Firebase_Inflate_Sink inflateSink(async.handler.inflate, &sink);
+    Firebase_Response_Pipeline pipeline(async.handler.inflate ? (Firebase_Response_Sink *)&inflateSink : &sink);
+#else
+    Firebase_Response_Pipeline pipeline(&sink);
+#endif
+
+    int r = pipeline.read(&tcpClient, async.handler, chunked,
+                          chunked ? (size_t)-1 : (size_t)(async.response.contentLen - async.handler.payloadRead));
+
+    // the payload is kept up to the response size limit
+    if (buf.length() > 0 && async.payload.length() < session.resp_size)
+        async.payload += MB_StringView(buf).substr(0, session.resp_size - async.payload.length());
+
+    if (r == FIREBASE_RESPONSE_BODY_ERROR)
+        return -1;
+
+    if (chunked)
+        return async.handler.chunkState.done() ? 1 : 0;
+
+    async.handler.payloadRead += r;
+    return async.handler.payloadRead >= async.response.contentLen ? 1 : 0;
+}
+
+void FirebaseData::completeAsync(int httpCode, size_t index, size_t pending)
+{
+    // the result is queued and sent from poll() as this can be called from the request that closed the session
+    if (_asyncResultCallback)
+    {
+        RTDB_AsyncResultInfo info;
+        info.index = index;
+        info.httpCode = httpCode;
+        info.payload = _asyncState.payload;
+        info.pending = pending;
+        _asyncResults.push_back(info);
+    }
+
+    _asyncState.reset();
+}
+
+void FirebaseData::sendAsyncResults()
+{
+    // the callback can send the next request which queues the results of the lost requests
+    while (_asyncResults.size() > 0)
+    {
+        RTDB_AsyncResultInfo info = _asyncResults[0];
+        _asyncResults.erase(_asyncResults.begin());
+        if (_asyncResultCallback)
+            _asyncResultCallback(info);
+    }
+}
+#endif
+
 bool FirebaseData::bufferOverflow()
 {
     return session.buffer_ovf;
@@ -784,6 +930,17 @@ void FirebaseData::closeSession()
 {
     setSession(false, false);
     Core.closeSession(&tcpClient, &session);
+
+#if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
+    // the responses of the asynchronous requests that were not read are lost with the connection
+    size_t lost = session.rtdb.async_count;
+    size_t read = session.rtdb.async_read;
+    session.rtdb.async_count = 0;
+    session.rtdb.async_read = 0;
+
+    for (size_t i = 0; i < lost; i++)
+        completeAsync(FIREBASE_ERROR_TCP_ERROR_CONNECTION_LOST, read + i + 1, lost - i - 1);
+#endif
 }
 
 bool FirebaseData::reconnect(unsigned long dataTime)
@@ -814,6 +971,9 @@ void FirebaseData::setSecure()
     setTimeout();
 
     tcpClient.setConfig(Core.config, &Core.mbfs);
+#if !defined(FIREBASE_DISABLE_DNS_CACHE)
+    tcpClient.setDNSCache(&Core.dnsCache);
+#endif
 
     if (!tcpClient.networkReady())
         return;
@@ -864,7 +1024,7 @@ void FirebaseData::setSecure()
 
 void FirebaseData::setCert(const char *ca)
 {
-    int ptr = reinterpret_cast<int>(ca);
+    uintptr_t ptr = reinterpret_cast<uintptr_t>(ca);
     if (ptr != session.cert_ptr)
     {
         session.cert_updated = true;
@@ -956,60 +1116,89 @@ bool FirebaseData::readPayload(MB_String *chunkOut, struct firebase_tcp_response
             if (!chunkOut)
                 return true;
 
-            char *pChunk = reinterpret_cast<char *>(Core.mbfs.newP(tcpHandler.chunkBufSize + 1));
+            // the payload is decoded from the receive buffer and appended to chunkOut
+            size_t ofs = chunkOut->length();
+            Firebase_String_Sink sink(*chunkOut);
+            // the decoded payload is also passed to the response callback
+            Firebase_Callback_Sink callbackSink(_responseCallback, &sink);
 
-            if (response.isChunkedEnc)
-                delay(1);
-            // read the avilable data
-            // chunk transfer encoding?
-            if (response.isChunkedEnc)
-                tcpHandler.bufferAvailable = Core.hh.readChunkedData(&Core.sh, &Core.mbfs, &tcpClient, pChunk, nullptr, tcpHandler);
-            else
-            {
+            if (readBody(_responseCallback ? (Firebase_Response_Sink *)&callbackSink : &sink, tcpHandler, response) > 0)
+                checkOvf(chunkOut->length() - ofs, response);
 
-                if (tcpHandler.payloadLen == 0)
-                    tcpHandler.bufferAvailable = Core.hh.readLine(&tcpClient, pChunk, tcpHandler.chunkBufSize);
-                else
-                {
-                    // for chunk base64 payload, we need to ensure the size is the multiples of 4 for decoding
-                    int readIndex = 0;
-                    while (readIndex < tcpHandler.chunkBufSize && tcpHandler.payloadRead + readIndex < tcpHandler.payloadLen)
-                    {
-                        int r = tcpClient.read();
-                        if (r > -1)
-                            pChunk[readIndex++] = (char)r;
-                        if (!reconnect(tcpHandler.dataTime))
-                            break;
-                    }
-                    tcpHandler.bufferAvailable = readIndex;
-                }
-            }
+            // the chunk that overflows the response buffer is not kept
+            if (session.buffer_ovf && chunkOut->length() > ofs)
+                chunkOut->erase(ofs);
+        }
 
-            if (tcpHandler.bufferAvailable > 0)
-            {
-                session.payload_length += tcpHandler.bufferAvailable;
-                if (session.max_payload_length < session.payload_length)
-                    session.max_payload_length = session.payload_length;
-                tcpHandler.payloadRead += tcpHandler.bufferAvailable;
+        return false;
+    }
 
-                if (_responseCallback)
-                    _responseCallback(pChunk);
+    return true;
+}
 
-                if (chunkOut)
+int FirebaseData::readBody(Firebase_Response_Sink *sink, struct firebase_tcp_response_handler_t &tcpHandler,
+                           struct server_response_data_t &response)
+{
+#if defined(FIREBASE_ENABLE_GZIP_RESPONSE)
+    // the compressed payload is decoded before writing to the sink, the payload read is counted in compressed bytes
+    Firebase_Inflate_Sink inflateSink(tcpHandler.inflate, sink);
+    Firebase_Response_Pipeline pipeline(tcpHandler.inflate ? (Firebase_Response_Sink *)&inflateSink : sink);
+#else
+    Firebase_Response_Pipeline pipeline(sink);
+#endif
+
+    if (response.isChunkedEnc)
+        delay(1);
+    // read the avilable data
+    // chunk transfer encoding?
+    if (response.isChunkedEnc)
+        tcpHandler.bufferAvailable = pipeline.read(&tcpClient, tcpHandler, true, tcpHandler.chunkBufSize);
+    else
+    {
+
+        if (tcpHandler.payloadLen == 0)
+            tcpHandler.bufferAvailable = pipeline.read(&tcpClient, tcpHandler, false, tcpHandler.chunkBufSize, true);
+        else
+        {
+            // read the chunk size or the remaining payload
+            int readIndex = 0;
+            while (readIndex < tcpHandler.chunkBufSize && tcpHandler.payloadRead + readIndex < tcpHandler.payloadLen)
+            {
+                int toRead = tcpHandler.chunkBufSize - readIndex;
+                if (toRead > tcpHandler.payloadLen - tcpHandler.payloadRead - readIndex)
+                    toRead = tcpHandler.payloadLen - tcpHandler.payloadRead - readIndex;
+
+                int r = pipeline.read(&tcpClient, tcpHandler, false, toRead);
+                if (r > 0)
+                    readIndex += r;
+                else if (r < 0)
                 {
-                    checkOvf(chunkOut->length() + tcpHandler.bufferAvailable, response);
-                    if (!session.buffer_ovf)
-                        *chunkOut += pChunk;
+                    readIndex = r;
+                    break;
                 }
+                if (!reconnect(tcpHandler.dataTime))
+                    break;
             }
-
-            Core.mbfs.delP(&pChunk);
+            tcpHandler.bufferAvailable = readIndex;
         }
+    }
 
-        return false;
+    if (tcpHandler.bufferAvailable > 0)
+    {
+        session.payload_length += tcpHandler.bufferAvailable;
+        if (session.max_payload_length < session.payload_length)
+            session.max_payload_length = session.payload_length;
+        tcpHandler.payloadRead += tcpHandler.bufferAvailable;
     }
 
-    return true;
+    // the payload is incomplete, the error is kept as the response code
+    if (tcpHandler.bufferAvailable == FIREBASE_RESPONSE_BODY_ERROR)
+    {
+        response.httpCode = tcpHandler.error.code;
+        session.response.code = tcpHandler.error.code;
+    }
+
+    return tcpHandler.bufferAvailable;
 }
 
 bool FirebaseData::readResponse(MB_String *payload, struct firebase_tcp_response_handler_t &tcpHandler,
@@ -1070,12 +1259,18 @@ bool FirebaseData::readResponse(MB_String *payload, struct firebase_tcp_response
                     if (!payload)
                         return true;
 
-                    MB_String pChunk;
-
-                    readPayload(&pChunk, tcpHandler, response);
-
-                    if (pChunk.length() > 0 && !_responseCallback)
-                        *payload += pChunk;
+                    // the payload is passed to the response callback instead when it was set
+                    if (_responseCallback)
+                    {
+                        Firebase_Callback_Sink callbackSink(_responseCallback);
+                        readBody(&callbackSink, tcpHandler, response);
+                    }
+                    else
+                    {
+                        if (tcpHandler.pChunkIdx == 1)
+                            Core.hh.reservePayload(*payload, response);
+                        readPayload(payload, tcpHandler, response);
+                    }
                 }
             }
         }
@@ -1084,6 +1279,41 @@ bool FirebaseData::readResponse(MB_String *payload, struct firebase_tcp_response
     return true;
 }
 
+bool FirebaseData::readResponseBody(MB_String *payload, struct firebase_tcp_response_handler_t &tcpHandler,
+                                    struct server_response_data_t &response)
+{
+    bool complete = false;
+
+    // read until the headers and the payload were completely read
+    while (tcpHandler.available() > 0 /* data available to read payload */ ||
+           tcpHandler.payloadRead < response.contentLen /* incomplete content read  */ ||
+           !tcpHandler.headerEnded /* incomplete headers read */)
+    {
+        if (!readResponse(payload, tcpHandler, response) && !response.isChunkedEnc)
+            break;
+
+        if (tcpHandler.bufferAvailable == FIREBASE_RESPONSE_BODY_ERROR)
+        {
+            // the truncated payload is not kept and the connection can't be reused
+            if (payload)
+                payload->clear();
+            closeSession();
+            return false;
+        }
+
+        // Last chunk?
+        if (Core.ut.isChunkComplete(&tcpHandler, &response, complete))
+            break;
+    }
+
+    // To make sure all chunks read and
+    // ready to send next request
+    if (response.isChunkedEnc)
+        tcpClient.flush();
+
+    return complete;
+}
+
 bool FirebaseData::prepareDownload(const MB_String &filename, firebase_mem_storage_type type, bool openFileInWrireMode)
 {
     if (!Core.config)
@@ -1137,203 +1367,159 @@ void FirebaseData::endDownloadOTA(struct firebase_tcp_response_handler_t &tcpHan
 #endif
 }
 
-bool FirebaseData::processDownload(const MB_String &filename, firebase_mem_storage_type type,
-                                   uint8_t *buf, int bufLen, struct firebase_tcp_response_handler_t &tcpHandler,
+bool FirebaseData::processDownload(const MB_String &filename, firebase_mem_storage_type type, int bufLen,
+                                   struct firebase_tcp_response_handler_t &tcpHandler,
                                    struct server_response_data_t &response, int &stage, bool isOTA)
 {
     if (!Core.config)
         return false;
 
+    // the data was written to the file or OTA in the read stage, the caller reports the progress in between
+    if (stage == 1)
+    {
+        stage = 0;
+        tcpHandler.pChunkIdx++;
+        return true;
+    }
+
     size_t available = tcpClient.available();
     tcpHandler.dataTime = millis();
 
     bool complete = false;
 
-    if (stage == 0 /* read stage */)
+    while (available == 0 && reconnect(tcpHandler.dataTime) && tcpClient.connected() &&
+           tcpHandler.payloadRead < response.contentLen)
     {
-        while (available == 0 && reconnect(tcpHandler.dataTime) && tcpClient.connected() &&
-               tcpHandler.payloadRead < response.contentLen)
-        {
-            available = tcpClient.available();
-        }
+        available = tcpClient.available();
+    }
 
-        if (available)
-        {
-            session.payload_length += available;
-            if (session.max_payload_length < session.payload_length)
-                session.max_payload_length = session.payload_length;
+    if (!available)
+        return false;
 
-            tcpHandler.dataTime = millis();
+    tcpHandler.dataTime = millis();
 
-            if ((int)available > bufLen)
-                available = bufLen;
+    // the binary payload is read in the buffer size instead of line by line
+    if (!response.isChunkedEnc && tcpHandler.payloadLen == 0)
+        tcpHandler.payloadLen = response.contentLen;
 
-            bool bufReady = false;
+    // the payload is decoded and written to the file or OTA through the pipeline without the intermediate buffer
+    Firebase_File_Sink fileSink(&Core.mbfs, filename, mbfs_type type);
+    Firebase_Response_Sink *out = &fileSink;
+#if defined(OTA_UPDATE_ENABLED) && (defined(ESP32) || defined(ESP8266) || defined(MB_ARDUINO_PICO))
+    Firebase_OTA_Sink otaSink;
+    if (isOTA)
+        out = &otaSink;
+#endif
+    Firebase_Base64_Sink base64Sink(&tcpHandler.base64State, out);
 
-            // for RTDB, read payload string instead
-            if (session.con_mode == firebase_con_mode_rtdb)
-            {
-                MB_String pChunk;
+    int read = 0;
 
-                readPayload(&pChunk, tcpHandler, response);
+    // for RTDB, the first chunk is read as string to check the base64 file signature
+    if (session.con_mode == firebase_con_mode_rtdb && tcpHandler.pChunkIdx == 1)
+    {
+        MB_String pChunk;
 
-                // Last chunk?
-                if (Core.ut.isChunkComplete(&tcpHandler, &response, complete))
-                    return true;
+        readPayload(&pChunk, tcpHandler, response);
 
-                if (tcpHandler.bufferAvailable > 0 && pChunk.length() > 0)
-                {
-                    strcpy((char *)buf, pChunk.c_str());
-                    bufReady = true;
+        // Last chunk?
+        if (Core.ut.isChunkComplete(&tcpHandler, &response, complete))
+            return true;
 
-                    if (tcpHandler.pChunkIdx == 1)
-                    {
-#if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
-                        // check for the request node path is empty or not found
-                        if (Core.sh.compare(session.rtdb.resp_etag, 0, firebase_rtdb_pgm_str_11 /* "null_etag" */))
-                        {
-                            session.response.code = FIREBASE_ERROR_PATH_NOT_EXIST;
-                            tcpHandler.error.code = FIREBASE_ERROR_PATH_NOT_EXIST;
-                            session.rtdb.path_not_found = true;
-                        }
-                        else
-                        {
-                            // based64 encoded string of file data
-                            tcpHandler.isBase64File = Core.sh.compare((char *)buf, 0, firebase_rtdb_pgm_str_8 /* "\"file,base64," */, true);
-                        }
-
-                        if (tcpHandler.isBase64File)
-                        {
-                            session.rtdb.resp_data_type = tcpHandler.downloadOTA ? d_file_ota : d_file;
-                            response.payloadOfs = 13; // payloadOfs must be 13 for signature len "\"file,base64,"
-
-                            // decoded data size may include pad which we don't know
-                            // from the first chunk until the last chunk
-                            if (response.contentLen > 0)
-                                tcpHandler.decodedPayloadLen = (3 * (response.contentLen - response.payloadOfs - 1) / 4);
-
-                            // check for pad length from base64 signature
-                            if (pChunk[1] == 'F')
-                                tcpHandler.base64PadLenSignature = 1;
-                            else if (pChunk[2] == 'I')
-                                tcpHandler.base64PadLenSignature = 2;
-
-                            if (tcpHandler.base64PadLenSignature > 0 && tcpHandler.decodedPayloadLen > 0)
-                            {
-                                // known padding from signature
-                                // then decoded data size (without padding)
-                                tcpHandler.decodedPayloadLen -= tcpHandler.base64PadLenSignature;
-                            }
-                        }
-#endif
-                    }
-                }
+        read = tcpHandler.bufferAvailable;
 
-                pChunk.clear();
-            }
-            else
-            {
-                tcpHandler.bufferAvailable = tcpClient.readBytes(buf, available);
-                bufReady = tcpHandler.bufferAvailable == (int)available;
-                tcpHandler.payloadRead += tcpHandler.bufferAvailable;
-            }
+        if (tcpHandler.bufferAvailable > 0 && pChunk.length() > 0)
+        {
+            int ofs = 0;
 #if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
-            if (session.con_mode == firebase_con_mode_rtdb && session.rtdb.path_not_found)
-                return false;
-#endif
-            if (bufReady)
+            // check for the request node path is empty or not found
+            if (Core.sh.compare(session.rtdb.resp_etag, 0, firebase_rtdb_pgm_str_11 /* "null_etag" */))
             {
-                stage = 1; // set stage to write
-                return true;
+                session.response.code = FIREBASE_ERROR_PATH_NOT_EXIST;
+                tcpHandler.error.code = FIREBASE_ERROR_PATH_NOT_EXIST;
+                session.rtdb.path_not_found = true;
+                return false;
             }
-        }
 
-        return false;
-    }
-    else /* write stage */
-    {
-        stage = 0; // set stage to read
-
-        MB_String payload;
-        int ofs = 0;
-        (void)ofs;
-
-        if (session.con_mode == firebase_con_mode_rtdb)
-        {
-            payload = (char *)buf;
+            // based64 encoded string of file data
+            tcpHandler.isBase64File = Core.sh.compare(pChunk, 0, firebase_rtdb_pgm_str_8 /* "\"file,base64," */, true);
 
             if (tcpHandler.isBase64File)
             {
-                if (tcpHandler.pChunkIdx == 1)
-                    ofs = response.payloadOfs;
-
-                tcpHandler.base64PadLenTail = Core.oh.trimLastChunkBase64(payload, payload.length());
-            }
-        }
-
-        if (isOTA)
-        {
-#if defined(OTA_UPDATE_ENABLED) && (defined(ESP32) || defined(ESP8266) || defined(MB_ARDUINO_PICO))
-            if (tcpHandler.error.code == 0)
-            {
-                bool ret = false;
-                if (session.con_mode == firebase_con_mode_rtdb && tcpHandler.isBase64File)
+                session.rtdb.resp_data_type = tcpHandler.downloadOTA ? d_file_ota : d_file;
+                response.payloadOfs = 13; // payloadOfs must be 13 for signature len "\"file,base64,"
+                ofs = response.payloadOfs;
+
+                // decoded data size may include pad which we don't know
+                // from the first chunk until the last chunk
+                if (response.contentLen > 0)
+                    tcpHandler.decodedPayloadLen = (3 * (response.contentLen - response.payloadOfs - 1) / 4);
+
+                // check for pad length from base64 signature
+                if (pChunk[1] == 'F')
+                    tcpHandler.base64PadLenSignature = 1;
+                else if (pChunk[2] == 'I')
+                    tcpHandler.base64PadLenSignature = 2;
+
+                if (tcpHandler.base64PadLenSignature > 0 && tcpHandler.decodedPayloadLen > 0)
                 {
-                    if (tcpHandler.pChunkIdx == 1)
-                        prepareDownloadOTA(tcpHandler, response);
-
-                    ret = Core.oh.decodeBase64OTA(&Core.bh, &Core.mbfs, payload.c_str() + ofs,
-                                                  payload.length() - ofs, tcpHandler.error.code);
+                    // known padding from signature
+                    // then decoded data size (without padding)
+                    tcpHandler.decodedPayloadLen -= tcpHandler.base64PadLenSignature;
                 }
-                else
-                    ret = Core.bh.updateWrite(buf, tcpHandler.bufferAvailable);
 
-                if (!ret)
-                    tcpHandler.error.code = FIREBASE_ERROR_FW_UPDATE_WRITE_FAILED;
+                if (isOTA)
+                    prepareDownloadOTA(tcpHandler, response);
+
+                tcpHandler.base64State.reset();
+                out = &base64Sink;
             }
+            else
+                tcpHandler.isBase64File = false;
 #endif
-        }
-        else
-        {
-
-            if (tcpHandler.error.code == 0)
+            if (tcpHandler.error.code == 0 && !out->write(pChunk.c_str() + ofs, pChunk.length() - ofs))
             {
-                int ret = 0;
-#if defined(ESP32_GT_2_0_1_FS_MEMORY_FIX)
-                // We open file to append here
-                ret = Core.mbfs.open(filename, mbfs_type type, mb_fs_open_mode_append);
-                if (ret < 0)
-                {
-                    tcpClient.flush();
-                    session.response.code = ret;
-                    return false;
-                }
-#endif
-#if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
-                if (session.con_mode == firebase_con_mode_rtdb && tcpHandler.isBase64File)
-                    ret = Core.bh.decodeToFile(&Core.mbfs, payload.c_str() + ofs, payload.length() - ofs,
-                                               mbfs_type session.rtdb.storage_type);
-                else
-#endif
-                    ret = Core.mbfs.write(mbfs_type type, buf, tcpHandler.bufferAvailable) == (int)tcpHandler.bufferAvailable;
-                FBUtils::idle();
-                if (!ret)
-                    tcpHandler.error.code = MB_FS_ERROR_FILE_IO_ERROR;
-
-#if defined(ESP32_GT_2_0_1_FS_MEMORY_FIX)
-                // We close file here after append
-                Core.mbfs.close(mbfs_type type);
-#else
-                if (tcpHandler.error.code == MB_FS_ERROR_FILE_IO_ERROR)
-                    Core.mbfs.close(mbfs_type type);
-#endif
+                tcpHandler.error.code = out->errorCode();
+                read = FIREBASE_RESPONSE_BODY_ERROR;
             }
         }
+    }
+    else
+    {
+        // limit the read size to the buffer size for the download progress report
+        if (session.con_mode != firebase_con_mode_rtdb)
+            tcpHandler.chunkBufSize = (int)available > bufLen ? bufLen : available;
 
-        tcpHandler.pChunkIdx++;
+        if (tcpHandler.isBase64File)
+            out = &base64Sink;
+
+        // the remaining payload is read without writing after the error e.g. the OTA can't be started
+        read = readBody(tcpHandler.error.code == 0 ? out : nullptr, tcpHandler, response);
+
+        // Last chunk?
+        if (Core.ut.isChunkComplete(&tcpHandler, &response, complete))
+            return true;
     }
 
-    return true;
+    if (tcpHandler.isBase64File && tcpHandler.base64State.done())
+        tcpHandler.base64PadLenTail = tcpHandler.base64State.padLength();
+
+    // the payload can't be decoded or written, the remaining payload is not read
+    if (read == FIREBASE_RESPONSE_BODY_ERROR)
+    {
+        response.httpCode = tcpHandler.error.code;
+        session.response.code = tcpHandler.error.code;
+        closeSession();
+        return false;
+    }
+
+    if (read > 0)
+    {
+        FBUtils::idle();
+        stage = 1; // set stage to report the progress
+        return true;
+    }
+
+    return false;
 }
 
 #if defined(ENABLE_GC_STORAGE) || defined(FIREBASE_ENABLE_GC_STORAGE) || defined(ENABLE_FB_STORAGE) || defined(FIREBASE_ENABLE_FB_STORAGE)
@@ -1657,6 +1843,7 @@ void FirebaseData::clear()
     _multiPathDataCallback = NULL;
     _timeoutCallback = NULL;
     _queueInfoCallback = NULL;
+    _asyncResultCallback = NULL;
 
     session.rtdb.raw.clear();
     session.rtdb.push_name.clear();
@@ -545,7 +545,8 @@ public:
       session.jsonPtr->clear();
       if (session.arrPtr)
         session.arrPtr->clear();
-      session.jsonPtr->setJsonData(session.rtdb.raw.c_str());
+      // the payload is copied as it is still used by e.g. jsonString()
+      session.jsonPtr->setJsonDataInSitu(session.rtdb.raw.c_str());
     }
     return session.jsonPtr;
   }
@@ -575,7 +576,8 @@ public:
       if (session.jsonPtr)
         session.jsonPtr->clear();
       session.arrPtr->clear();
-      session.arrPtr->setJsonArrayData(session.rtdb.raw.c_str());
+      // the payload is copied as it is still used by e.g. jsonString()
+      session.arrPtr->setJsonArrayDataInSitu(session.rtdb.raw.c_str());
     }
 
     return session.arrPtr;
@@ -633,6 +635,32 @@ public:
    */
   bool httpConnected();
 
+  /** Set the callback function for the result of the asynchronous requests e.g. setAsync, pushAsync,
+   * updateNodeAsync and deleteNodeAsync (RTDB only).
+   *
+   * @param callback The callback function that accepts RTDB_AsyncResultInfo data.
+   *
+   * @note The results are read and reported in the order of the requests when poll() or Firebase.poll() was called.
+   * The requests that their responses were not read when the connection was closed are reported with
+   * FIREBASE_ERROR_TCP_ERROR_CONNECTION_LOST http code by the next poll().
+   * The callback is only called from poll(), the next request can be sent from the callback.
+   */
+#if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
+  void setAsyncResultCallback(RTDB_AsyncResultCallback callback);
+#endif
+
+  /** Read the available responses of the asynchronous requests without waiting (RTDB only).
+   *
+   * @return The number of the asynchronous requests that are waiting for the response.
+   *
+   * @note The connection is kept open for the next synchronous request when all responses were read.
+   * Only the responses are read without waiting, the connection, TLS handshake and sending of the requests
+   * still block the caller, and the other services (Firestore, FCM, Storage) are not polled.
+   */
+#if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
+  size_t poll();
+#endif
+
   /** Get the timeout event of the server's stream (30 sec is the default) (RTDB only).
    * Nothing to do when stream connection timeout, the stream connection will be automatically resumed.
    *
@@ -770,6 +798,10 @@ private:
   MultiPathStreamEventCallback _multiPathDataCallback = NULL;
   StreamTimeoutCallback _timeoutCallback = NULL;
   QueueInfoCallback _queueInfoCallback = NULL;
+  RTDB_AsyncResultCallback _asyncResultCallback = NULL;
+  struct firebase_rtdb_async_response_t _asyncState;
+  // the results that are passed to the callback from poll(), not from the request that closed the session
+  MB_VECTOR<RTDB_AsyncResultInfo> _asyncResults;
 #endif
 #if defined(FIREBASE_ESP_CLIENT)
 #if defined(ENABLE_FB_FUNCTIONS) || defined(FIREBASE_ENABLE_FB_FUNCTIONS)
@@ -821,6 +853,12 @@ private:
 
   void closeSession();
   bool handleStreamRead();
+#if defined(ENABLE_RTDB) || defined(FIREBASE_ENABLE_RTDB)
+  void readAsync();
+  int readAsyncPayload();
+  void completeAsync(int httpCode, size_t index, size_t pending);
+  void sendAsyncResults();
+#endif
 #if defined(ENABLE_GC_STORAGE) || defined(FIREBASE_ENABLE_GC_STORAGE)
   void createResumableTask(struct fb_gcs_upload_resumable_task_info_t &ruTask, size_t fileSize,
                            const MB_String &location, const MB_String &local, const MB_String &remote,
@@ -831,13 +869,17 @@ private:
   void waitRxReady();
   bool readPayload(MB_String *chunkOut, struct firebase_tcp_response_handler_t &tcpHandler,
                    struct server_response_data_t &response);
+  int readBody(Firebase_Response_Sink *sink, struct firebase_tcp_response_handler_t &tcpHandler,
+               struct server_response_data_t &response);
   bool readResponse(MB_String *payload, struct firebase_tcp_response_handler_t &tcpHandler,
                     struct server_response_data_t &response);
+  bool readResponseBody(MB_String *payload, struct firebase_tcp_response_handler_t &tcpHandler,
+                        struct server_response_data_t &response);
   bool prepareDownload(const MB_String &filename, firebase_mem_storage_type type, bool openFileInWrireMode = false);
   void prepareDownloadOTA(struct firebase_tcp_response_handler_t &tcpHandler, struct server_response_data_t &response);
   void endDownloadOTA(struct firebase_tcp_response_handler_t &tcpHandler);
-  bool processDownload(const MB_String &filename, firebase_mem_storage_type type, uint8_t *buf,
-                       int bufLen, struct firebase_tcp_response_handler_t &tcpHandler, struct server_response_data_t &response,
+  bool processDownload(const MB_String &filename, firebase_mem_storage_type type, int bufLen,
+                       struct firebase_tcp_response_handler_t &tcpHandler, struct server_response_data_t &response,
                        int &stage, bool isOTA);
 #if defined(ENABLE_GC_STORAGE) || defined(FIREBASE_ENABLE_GC_STORAGE) || defined(ENABLE_FB_STORAGE) || defined(FIREBASE_ENABLE_FB_STORAGE)
   bool getUploadInfo(int type, int &stage, const MB_String &pChunk, bool isList, bool isMeta,
@@ -868,13 +910,13 @@ private:
   void mSetFloatValue(const char *value);
   void mSetBoolValue(bool value);
   template <typename T>
-  void restoreValue(int addr)
+  void restoreValue(uintptr_t addr)
   {
     T *ptr = addrTo<T *>(addr);
     if (ptr)
       *ptr = to<T>();
   }
-  void restoreCString(int addr)
+  void restoreCString(uintptr_t addr)
   {
     char *ptr = addrTo<char *>(addr);
     if (ptr)
@@ -419,26 +419,12 @@ bool FB_Storage::fcs_sendRequest(FirebaseData *fbdo, struct firebase_fcs_req_t *
         Core.hh.addContentLengthHeader(header, len);
     }
 
-    Core.hh.addGAPIsHostHeader(header, firebase_storage_ss_pgm_str_1 /* "firebasestorage." */);
+    Core.hh.addGAPIsHostHeaderFields(&Core.sh, header, fbdo->session.header_template,
+                                     firebase_storage_ss_pgm_str_1 /* "firebasestorage." */, Core.config->signer.customHeaders);
 
     if (!Core.config->signer.test_mode)
-    {
-        Core.hh.addAuthHeaderFirst(header, Core.getTokenType());
-
-        fbdo->tcpSend(header.c_str());
-        header.clear();
-
-        if (fbdo->session.response.code < 0)
-            return false;
-
-        fbdo->tcpSend(Core.getToken());
+        Core.hh.addAuthHeader(header, Core.getTokenType(), Core.getToken());
 
-        if (fbdo->session.response.code < 0)
-            return false;
-
-        Core.hh.addNewLine(header);
-    }
-    Core.hh.addUAHeader(header);
     // required for ESP32 core sdk v2.0.x.
     bool keepAlive = false;
 #if defined(USE_CONNECTION_KEEP_ALIVE_MODE) || defined(FIREBASE_USE_CONNECTION_KEEP_ALIVE_MODE)
@@ -446,7 +432,10 @@ bool FB_Storage::fcs_sendRequest(FirebaseData *fbdo, struct firebase_fcs_req_t *
 #endif
     Core.hh.addConnectionHeader(header, keepAlive);
 
-    Core.hh.getCustomHeaders(&Core.sh,header, Core.config->signer.customHeaders);
+    // the downloaded file is written as it was received
+    if (req->requestType != firebase_fcs_request_type_download && req->requestType != firebase_fcs_request_type_download_ota)
+        Core.hh.addAcceptEncodingHeader(header);
+
     Core.hh.addNewLine(header);
 
     fbdo->session.response.code = FIREBASE_ERROR_TCP_ERROR_NOT_CONNECTED;
@@ -643,21 +632,18 @@ bool FB_Storage::handleResponse(FirebaseData *fbdo, struct firebase_fcs_req_t *r
 
                 if (bufLen > 1024 * 16)
                     bufLen = 1024 * 16;
-                uint8_t *buf = reinterpret_cast<uint8_t *>(Core.mbfs.newP(bufLen, false));
 
                 int stage = 0;
 
                 if (isOTA)
                     fbdo->prepareDownloadOTA(tcpHandler, response);
 
-                while (fbdo->processDownload(req->localFileName, req->storageType, buf, bufLen, tcpHandler, response, stage, isOTA))
+                while (fbdo->processDownload(req->localFileName, req->storageType, bufLen, tcpHandler, response, stage, isOTA))
                 {
                     if (stage)
                         reportDownloadProgress(fbdo, req, tcpHandler.payloadRead);
                 }
 
-                Core.mbfs.delP(&buf);
-
                 if (!isOTA)
                 {
                     if ((int)req->fileSize == tcpHandler.payloadRead)